@@ -0,0 +1,587 @@
+#pragma once
+
+// Member access for aggregates without reflection: the member count is the largest number of initializers a braced
+// initialisation accepts, and members are then bound by a structured binding of that size
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace fastcsv::detail
+{
+
+    inline constexpr size_t max_aggregate_arity = 64ul;
+
+    // Converts to any member type, only used in unevaluated contexts
+    struct any_field
+    {
+        template <typename T>
+        operator T() const;
+    };
+
+    template <size_t>
+    using indexed_any_field = any_field;
+
+    // Converts only to the base classes of TAggregate
+    template <typename TAggregate>
+    struct base_field
+    {
+        template <
+            typename T,
+            std::enable_if_t<std::is_base_of_v<T, TAggregate> && !std::is_same_v<T, TAggregate>> * = nullptr>
+        operator T() const;
+    };
+
+    // Initializers of one member each
+    template <typename T, typename TIndices, typename = void>
+    inline constexpr bool is_brace_constructible = false;
+
+    template <typename T, size_t... Is>
+    inline constexpr bool is_brace_constructible<
+        T,
+        std::index_sequence<Is...>,
+        std::void_t<decltype(T{ indexed_any_field<Is>{}... })>> = true;
+
+    // Every initializer in its own braces, so none is spread over the elements of an array member
+    template <typename T, typename TIndices, typename = void>
+    inline constexpr bool is_member_wise_constructible = false;
+
+    template <typename T, size_t... Is>
+    inline constexpr bool is_member_wise_constructible<
+        T,
+        std::index_sequence<Is...>,
+        std::void_t<decltype(T{ { indexed_any_field<Is>{} }... })>> = true;
+
+    // Bases are initialised before the members, so the first initializer of an aggregate with a base can be one
+    template <typename T, typename = void>
+    inline constexpr bool has_aggregate_base = false;
+
+    template <typename T>
+    inline constexpr bool has_aggregate_base<T, std::void_t<decltype(T{ base_field<T>{} })>> = true;
+
+    template <typename T, typename TIndices>
+    struct brace_probe : std::bool_constant<is_brace_constructible<T, TIndices>>
+    {
+    };
+
+    template <typename T, typename TIndices>
+    struct member_wise_probe : std::bool_constant<is_member_wise_constructible<T, TIndices>>
+    {
+    };
+
+    // Largest number of initializers TProbe accepts for T
+    template <typename T, template <typename, typename> class TProbe, size_t Low, size_t High>
+    constexpr size_t find_aggregate_arity() noexcept
+    {
+        if constexpr (Low == High) { return Low; }
+        else
+        {
+            constexpr auto middle = (Low + High + 1ul) / 2ul;
+            if constexpr (TProbe<T, std::make_index_sequence<middle>>::value)
+            {
+                return find_aggregate_arity<T, TProbe, middle, High>();
+            }
+            else
+            {
+                return find_aggregate_arity<T, TProbe, Low, middle - 1ul>();
+            }
+        }
+    }
+
+    /// Number of members of the aggregate T, C array members and base classes are not supported
+    template <typename T>
+    inline constexpr size_t aggregate_arity_v = find_aggregate_arity<T, brace_probe, 0ul, max_aggregate_arity>();
+
+    /// True when each initializer of T goes to one direct member, which is what a structured binding of
+    /// aggregate_arity_v names needs. Base classes take initializers of their own, and C array members take several
+    /// through brace elision
+    template <typename T>
+    inline constexpr bool is_member_wise_aggregate_v
+        = !has_aggregate_base<T>
+       && aggregate_arity_v<T> == find_aggregate_arity<T, member_wise_probe, 0ul, max_aggregate_arity>();
+
+    /// std::tie of every member of the aggregate value
+    template <typename T>
+    constexpr auto tie_members(T & value) noexcept
+    {
+        constexpr auto arity = aggregate_arity_v<std::remove_const_t<T>>;
+        static_assert(arity != 0ul, "tie_members requires an aggregate with at least one member");
+
+        if constexpr (arity == 1ul)
+        {
+            auto & [m0] = value;
+            return std::tie(m0);
+        }
+        else if constexpr (arity == 2ul)
+        {
+            auto & [m0, m1] = value;
+            return std::tie(m0, m1);
+        }
+        else if constexpr (arity == 3ul)
+        {
+            auto & [m0, m1, m2] = value;
+            return std::tie(m0, m1, m2);
+        }
+        else if constexpr (arity == 4ul)
+        {
+            auto & [m0, m1, m2, m3] = value;
+            return std::tie(m0, m1, m2, m3);
+        }
+        else if constexpr (arity == 5ul)
+        {
+            auto & [m0, m1, m2, m3, m4] = value;
+            return std::tie(m0, m1, m2, m3, m4);
+        }
+        else if constexpr (arity == 6ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5);
+        }
+        else if constexpr (arity == 7ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6);
+        }
+        else if constexpr (arity == 8ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7);
+        }
+        else if constexpr (arity == 9ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8);
+        }
+        else if constexpr (arity == 10ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9);
+        }
+        else if constexpr (arity == 11ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
+        }
+        else if constexpr (arity == 12ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
+        }
+        else if constexpr (arity == 13ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
+        }
+        else if constexpr (arity == 14ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
+        }
+        else if constexpr (arity == 15ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
+        }
+        else if constexpr (arity == 16ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+        }
+        else if constexpr (arity == 17ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16);
+        }
+        else if constexpr (arity == 18ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17);
+        }
+        else if constexpr (arity == 19ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18);
+        }
+        else if constexpr (arity == 20ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19);
+        }
+        else if constexpr (arity == 21ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20);
+        }
+        else if constexpr (arity == 22ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20,
+                m21] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21);
+        }
+        else if constexpr (arity == 23ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22);
+        }
+        else if constexpr (arity == 24ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23);
+        }
+        else if constexpr (arity == 25ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24);
+        }
+        else if constexpr (arity == 26ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25);
+        }
+        else if constexpr (arity == 27ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26);
+        }
+        else if constexpr (arity == 28ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27);
+        }
+        else if constexpr (arity == 29ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28);
+        }
+        else if constexpr (arity == 30ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29);
+        }
+        else if constexpr (arity == 31ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30);
+        }
+        else if constexpr (arity == 32ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31);
+        }
+        else if constexpr (arity == 33ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32);
+        }
+        else if constexpr (arity == 34ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33);
+        }
+        else if constexpr (arity == 35ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34);
+        }
+        else if constexpr (arity == 36ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35);
+        }
+        else if constexpr (arity == 37ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36);
+        }
+        else if constexpr (arity == 38ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37);
+        }
+        else if constexpr (arity == 39ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38);
+        }
+        else if constexpr (arity == 40ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39);
+        }
+        else if constexpr (arity == 41ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39,
+                m40);
+        }
+        else if constexpr (arity == 42ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41);
+        }
+        else if constexpr (arity == 43ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41,
+                m42] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42);
+        }
+        else if constexpr (arity == 44ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43);
+        }
+        else if constexpr (arity == 45ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44);
+        }
+        else if constexpr (arity == 46ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45);
+        }
+        else if constexpr (arity == 47ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46);
+        }
+        else if constexpr (arity == 48ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47);
+        }
+        else if constexpr (arity == 49ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48);
+        }
+        else if constexpr (arity == 50ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49);
+        }
+        else if constexpr (arity == 51ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50);
+        }
+        else if constexpr (arity == 52ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51);
+        }
+        else if constexpr (arity == 53ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52);
+        }
+        else if constexpr (arity == 54ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53);
+        }
+        else if constexpr (arity == 55ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54);
+        }
+        else if constexpr (arity == 56ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55);
+        }
+        else if constexpr (arity == 57ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56);
+        }
+        else if constexpr (arity == 58ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57);
+        }
+        else if constexpr (arity == 59ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58);
+        }
+        else if constexpr (arity == 60ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59);
+        }
+        else if constexpr (arity == 61ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60);
+        }
+        else if constexpr (arity == 62ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60,
+                m61);
+        }
+        else if constexpr (arity == 63ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61,
+                m62] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61,
+                m62);
+        }
+        else if constexpr (arity == 64ul)
+        {
+            auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21,
+                m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40, m41, m42,
+                m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61, m62,
+                m63] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19,
+                m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31, m32, m33, m34, m35, m36, m37, m38, m39, m40,
+                m41, m42, m43, m44, m45, m46, m47, m48, m49, m50, m51, m52, m53, m54, m55, m56, m57, m58, m59, m60, m61,
+                m62, m63);
+        }
+    }
+
+    template <typename TTie>
+    struct tie_value_types;
+
+    template <typename... Ts>
+    struct tie_value_types<std::tuple<Ts &...>>
+    {
+        using type = std::tuple<std::remove_const_t<Ts>...>;
+    };
+
+    /// std::tuple of the member types of the aggregate T
+    template <typename T>
+    using aggregate_members_t = typename tie_value_types<decltype(tie_members(std::declval<T &>()))>::type;
+
+}  // namespace fastcsv::detail
@@ -73,29 +73,76 @@
     #define FASTCSV_HAS_FROM_CHAR
 #endif
 
+#if !defined(FASTCSV_NO_SIMD)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define FASTCSV_HAS_SSE2
+    #endif
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define FASTCSV_BIG_ENDIAN
+#endif
+
+
+#include <fastcsv/aggregate.hpp>
+#include <fastcsv/eisel_lemire.hpp>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 #include <fmt/printf.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #if defined(FASTCSV_HAS_FROM_CHAR)
     #include <charconv>
 #endif
-#if defined(FASTCSV_HAS_CXX20)
-    #include <chrono>
-#endif
+#include <cctype>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <future>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <random>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <variant>
 #include <vector>
 
+#if defined(FASTCSV_HAS_SSE2)
+    #include <emmintrin.h>
+#endif
+#if defined(FASTCSV_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+#if defined(FASTCSV_PLATFORM_LINUX)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+#if defined(FASTCSV_HAS_ZLIB)
+    #include <zlib.h>
+#endif
+
+// <charconv> only advertises the feature once floating point to_chars is implemented too
+#if defined(FASTCSV_HAS_FROM_CHAR) && defined(__cpp_lib_to_chars)
+    #define FASTCSV_HAS_FLOAT_TO_CHARS
+#endif
+
 
 using namespace std::string_view_literals;
 
@@ -112,6 +159,32 @@ namespace fastcsv
     template <typename T>
     struct csv_headers;
 
+    /// Specialise with a constexpr `values` table of name and value pairs to read and write T by name, e.g.
+    ///
+    ///     template <>
+    ///     struct enum_mapping<side>
+    ///     {
+    ///         static constexpr std::array<std::pair<std::string_view, side>, 2> values{
+    ///             { { "buy", side::buy }, { "sell", side::sell } }
+    ///         };
+    ///     };
+    ///
+    /// A value may be listed under several names, the first one is written
+    template <typename T>
+    struct enum_mapping;
+
+    /// True for types whose written form never holds a column delimiter, quote or line end, set for the built-in
+    /// numeric, decimal, chrono and enum_mapping types. Rows made only of such fields whose to_csv also provides a
+    /// static constexpr max_chars and a static format(value, dest) are formatted in place after reserving the whole
+    /// row once, specialise it for types of your own that provide both
+    template <typename T, typename = void>
+    struct csv_never_needs_quoting : std::false_type
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool csv_never_needs_quoting_v = csv_never_needs_quoting<T>::value;
+
     template <typename T, typename = void>
     inline constexpr bool has_from_csv = false;
 
@@ -124,6 +197,12 @@ namespace fastcsv
     template <typename T>
     inline constexpr bool has_to_csv<T, decltype(void(sizeof(to_csv<T>)))> = true;
 
+    template <typename T, typename = void>
+    inline constexpr bool has_enum_mapping = false;
+
+    template <typename T>
+    inline constexpr bool has_enum_mapping<T, std::void_t<decltype(enum_mapping<T>::values)>> = true;
+
     template <typename T, typename = void>
     inline constexpr bool has_csv_headers = false;
 
@@ -144,6 +223,12 @@ namespace fastcsv
         template <> inline constexpr std::string_view csv_extension<char> = ".csv"sv;
         template <> inline constexpr std::wstring_view csv_extension<wchar_t> = LR"(.csv)";
 
+        template <typename TElem, typename TTraits = std::char_traits<TElem>>
+        inline constexpr std::basic_string_view<TElem, TTraits> gzip_extension;
+
+        template <> inline constexpr std::string_view gzip_extension<char> = ".gz"sv;
+        template <> inline constexpr std::wstring_view gzip_extension<wchar_t> = LR"(.gz)";
+
 
         template <typename TElem, typename TTraits = std::char_traits<TElem>>
         inline constexpr TElem quote;
@@ -202,6 +287,51 @@ namespace fastcsv
 #endif
         // clang-format on
 
+        FASTCSV_NO_DISCARD inline unsigned count_trailing_zeros(uint32_t mask) noexcept
+        {
+#if defined(FASTCSV_COMPILER_MSVC)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+        }
+
+        // Returns a pointer to the first char in [first, last) equal to any of the four values, or last if there is
+        // none
+        template <typename TElem>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR const TElem * find_first_of(
+            const TElem * first, const TElem * last, TElem a, TElem b, TElem c, TElem d) noexcept
+        {
+#if defined(FASTCSV_HAS_SSE2) && defined(FASTCSV_HAS_CXX20)
+            if constexpr (sizeof(TElem) == 1ul)
+            {
+                if (!std::is_constant_evaluated())
+                {
+                    const auto needleA = _mm_set1_epi8(static_cast<char>(a));
+                    const auto needleB = _mm_set1_epi8(static_cast<char>(b));
+                    const auto needleC = _mm_set1_epi8(static_cast<char>(c));
+                    const auto needleD = _mm_set1_epi8(static_cast<char>(d));
+                    for (; last - first >= 16; first += 16)
+                    {
+                        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+                        const auto matches = _mm_or_si128(
+                            _mm_or_si128(_mm_cmpeq_epi8(chunk, needleA), _mm_cmpeq_epi8(chunk, needleB)),
+                            _mm_or_si128(_mm_cmpeq_epi8(chunk, needleC), _mm_cmpeq_epi8(chunk, needleD)));
+                        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+                        if (mask != 0u) { return first + count_trailing_zeros(mask); }
+                    }
+                }
+            }
+#endif
+            for (; first != last; ++first)
+            {
+                if (*first == a || *first == b || *first == c || *first == d) { return first; }
+            }
+            return last;
+        }
+
         template <typename TElem, typename TTraits = std::char_traits<TElem>>
         class basic_csv_parser final
         {
@@ -213,8 +343,16 @@ namespace fastcsv
             size_t lineStart_;
             size_t columnStart_;
             size_t columnEnd_;
+            // the field consumed last on the current line, consumedStart_ is npos before the first one
+            size_t consumedStart_;
+            size_t consumedEnd_;
+            bool recordErrors_;
+            std::errc error_;
+            size_t errorOffset_;
 
         public:
+            static constexpr size_t npos = static_cast<size_t>(-1);
+
             FASTCSV_CONSTEXPR basic_csv_parser(
                 std::basic_string_view<TElem, TTraits> content,
                 TElem columnDelimiter = default_column_delimiter<TElem>,
@@ -227,6 +365,11 @@ namespace fastcsv
               , lineStart_(0ul)
               , columnStart_(0ul)
               , columnEnd_(find_column_end(columnStart_))
+              , consumedStart_(npos)
+              , consumedEnd_(npos)
+              , recordErrors_(false)
+              , error_()
+              , errorOffset_(0ul)
             { }
 
             FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool end_of_line() const
@@ -258,6 +401,9 @@ namespace fastcsv
 
             FASTCSV_CONSTEXPR bool advance_column()
             {
+                consumedStart_ = columnStart_;
+                consumedEnd_ = columnEnd_;
+
                 if (columnEnd_ == content_.size()
                     || content_[columnEnd_] == new_line<TElem> || content_[columnEnd_] == caridge_return<TElem>)
                 {
@@ -288,6 +434,7 @@ namespace fastcsv
 
                 lineStart_ = columnStart_ = std::min(columnEnd_ + advanceChars, content_.size());
                 columnEnd_ = find_column_end(columnStart_);
+                consumedStart_ = npos;
 
                 return true;
             }
@@ -299,65 +446,115 @@ namespace fastcsv
                 return value;
             }
 
-        private:
-            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t find_column_end(size_t pos) const
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t line_start() const noexcept { return lineStart_; }
+
+            /// Restarts parsing at position, which must be the start of a line
+            FASTCSV_CONSTEXPR void seek_line(size_t position)
             {
-                if (pos >= content_.size()) { return content_.size(); }
+                lineStart_ = columnStart_ = std::min(position, content_.size());
+                columnEnd_ = find_column_end(columnStart_);
+                consumedStart_ = npos;
+            }
 
-                auto current = content_[pos];
+            /// The field a conversion that threw was working on, the last one consumed on the current line or the
+            /// current one when none has been consumed yet
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR std::basic_string_view<TElem, TTraits> failed_field() const
+            {
+                if (consumedStart_ == npos) { return current_column(); }
+                if (consumedStart_ == content_.size()) { return std::basic_string_view<TElem, TTraits>(); }
 
-                while (pos < content_.size())
+                return std::basic_string_view<TElem, TTraits>(
+                    content_.data() + consumedStart_,
+                    consumedEnd_ - consumedStart_);
+            }
+
+            /// When enabled, conversions record their first failure on the current line instead of throwing
+            FASTCSV_CONSTEXPR void record_errors(bool enabled) noexcept { recordErrors_ = enabled; }
+
+            /// Records a failed conversion of element, a view into the content, and returns false when the caller
+            /// should throw instead. Only the byte offset is kept, see locate for the line and column
+            FASTCSV_CONSTEXPR bool record_error(std::errc code, std::basic_string_view<TElem, TTraits> element) noexcept
+            {
+                if (error_ == std::errc())
                 {
-                    if (current == columnDelimiter_) { return pos; }
+                    error_ = code;
+                    errorOffset_ = element.data() == nullptr ? content_.size()
+                                                             : static_cast<size_t>(element.data() - content_.data());
+                }
+                return recordErrors_;
+            }
 
-                    // quoted strings
-                    else if (current == stringDelimiter_)
-                    {
-                        ++pos;
-                        if (pos == content_.size()) { return pos; }
-                        current = content_[pos];
-                        bool stringFinished = false;
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool has_error() const noexcept { return error_ != std::errc(); }
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR std::errc error() const noexcept { return error_; }
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t error_offset() const noexcept { return errorOffset_; }
 
-                        while (!stringFinished && pos < content_.size())
-                        {
-                            if (current == stringDelimiter_)
-                            {
-                                // quoted string end
-                                ++pos;
-                                stringFinished = true;
-                            }
-                            else if (current == escapeChar_)
-                            {
-                                // advance two chars if next is an escaped quote
-                                pos += 1 + bool(pos + 1ul < content_.size() && content_[pos + 1ul] == stringDelimiter_);
-                                current = content_[pos];
-                            }
-                            else
-                            {
-                                // advance
-                                ++pos;
-                            }
+            /// Zero based column of the recorded failure, found by walking the line again so the happy path does not
+            /// have to count columns
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t error_column() const { return column_of(errorOffset_); }
 
-                            if (pos == content_.size()) { return pos; }
-                            current = content_[pos];
-                        }
+            /// Zero based column containing offset, offsets past the end of the current line map to its last column
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t column_of(size_t offset) const
+            {
+                auto column = 0ul;
+                for (auto end = find_column_end(lineStart_); offset > end; end = find_column_end(end + 1ul))
+                {
+                    if (end == content_.size() || content_[end] == new_line<TElem>
+                        || content_[end] == caridge_return<TElem>)
+                    {
+                        break;
                     }
-                    else
+                    ++column;
+                }
+                return column;
+            }
+
+            FASTCSV_CONSTEXPR void clear_error() noexcept { error_ = std::errc(); }
+
+        private:
+            FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t find_column_end(size_t pos) const
+            {
+                const auto first = content_.data();
+                const auto last = content_.data() + content_.size();
+
+                while (pos < content_.size())
+                {
+                    // skip to the next delimiter, quote or line end
+                    pos = static_cast<size_t>(
+                        find_first_of(
+                            first + pos,
+                            last,
+                            columnDelimiter_,
+                            stringDelimiter_,
+                            new_line<TElem>,
+                            caridge_return<TElem>)
+                        - first);
+                    if (pos == content_.size() || content_[pos] != stringDelimiter_) { return pos; }
+
+                    // quoted strings run to the next quote that is not escaped
+                    ++pos;
+                    while (true)
                     {
-                        switch (current)
-                        {
-                        // line of end
-                        case new_line<TElem>:
-                        case caridge_return<TElem>: return pos;
+                        pos = static_cast<size_t>(
+                            find_first_of(
+                                first + pos,
+                                last,
+                                stringDelimiter_,
+                                escapeChar_,
+                                stringDelimiter_,
+                                escapeChar_)
+                            - first);
+                        if (pos == content_.size()) { return pos; }
 
-                        // advance
-                        default: {
+                        if (content_[pos] == stringDelimiter_)
+                        {
                             ++pos;
-                            if (pos == content_.size()) { return pos; }
-                            current = content_[pos];
-                        }
-                        break;
+                            break;
                         }
+
+                        // advance two chars if next is an escaped quote
+                        pos += 1ul
+                               + static_cast<size_t>(
+                                   pos + 1ul < content_.size() && content_[pos + 1ul] == stringDelimiter_);
                     }
                 }
 
@@ -368,861 +565,5947 @@ namespace fastcsv
         using csv_parser = basic_csv_parser<char>;
         using w_csv_parser = basic_csv_parser<wchar_t>;
 
-
-        template <typename T, typename = void>
-        inline constexpr bool has_from_chars_integral_v = false;
-
-        template <typename T>
-        inline constexpr bool has_from_chars_integral_v<
-            T,
-            std::void_t<decltype(std::from_chars(
-                std::declval<const char *>(),
-                std::declval<const char *>(),
-                std::declval<T &>(),
-                std::declval<const int>()))>> = true;
-
-        template <typename T, typename = void>
-        inline constexpr bool has_from_chars_floating_point_v = false;
-
-        template <typename T>
-        inline constexpr bool has_from_chars_floating_point_v<
-            T,
-            std::void_t<decltype(std::from_chars(
-                std::declval<const char *>(),
-                std::declval<const char *>(),
-                std::declval<T &>(),
-                std::declval<const std::chars_format>()))>> = true;
-
-        template <typename T, typename... Ts>
-        constexpr bool is_one_of_v()
+        FASTCSV_NO_DISCARD inline unsigned popcount(uint32_t mask) noexcept
         {
-            return (std::is_same_v<T, Ts> || ...);
+#if defined(FASTCSV_COMPILER_MSVC)
+            return static_cast<unsigned>(__popcnt(mask));
+#else
+            return static_cast<unsigned>(__builtin_popcount(mask));
+#endif
         }
 
-        template <
-            size_t INDEX = 0u,
-            typename TTuple,
-            size_t SIZE = std::tuple_size_v<std::remove_reference_t<TTuple>>,
-            typename TCallable,
-            typename... TArgs>
-        void for_each(TTuple && tuple, TCallable && callable, TArgs &&... args)
+        // Returns a pointer to the first occurrence of value in [first, last), or last if there is none
+        template <typename TElem, typename TTraits = std::char_traits<TElem>>
+        FASTCSV_NO_DISCARD inline const TElem * find_first(
+            const TElem * first, const TElem * last, TElem value) noexcept
         {
-            if constexpr (INDEX >= SIZE) { return; }
-            else
+#if defined(FASTCSV_HAS_SSE2)
+            if constexpr (sizeof(TElem) == 1ul)
             {
-                std::invoke(callable, args..., std::get<INDEX>(tuple));
-                for_each<INDEX + 1ul>(
-                    std::forward<TTuple>(tuple),
-                    std::forward<TCallable>(callable),
-                    std::forward<TArgs>(args)...);
+                const auto needle = _mm_set1_epi8(static_cast<char>(value));
+                for (; last - first >= 16; first += 16)
+                {
+                    const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+                    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+                    if (mask != 0u) { return first + count_trailing_zeros(mask); }
+                }
             }
+#endif
+            const auto found = TTraits::find(first, static_cast<size_t>(last - first), value);
+            return found ? found : last;
         }
 
-        template <typename... Ts>
-        std::tuple<std::vector<Ts>...> make_reserved_vectors(size_t size)
+        // Counts the line ends in [first, last), where "\n", "\r\n" and a lone "\r" each end one line, and sets
+        // lineStart to the start of the last line. Quoted fields may contain line ends so counting gives up at the
+        // first quote
+        template <typename TElem, typename TTraits = std::char_traits<TElem>>
+        FASTCSV_NO_DISCARD inline bool count_line_ends(
+            const TElem * first, const TElem * last, size_t & count, const TElem *& lineStart) noexcept
         {
-            auto vectors = std::tuple<std::vector<Ts>...>();
-            for_each(
-                vectors,
-                [](size_t size, auto & vec) { vec.reserve(size); },
-                size);
-            return vectors;
-        }
+            count = 0ul;
+            lineStart = first;
 
-        template <typename TAdapter, typename TIn>
-        using adapter_result_t = std::invoke_result_t<TAdapter, TIn>;
+#if defined(FASTCSV_HAS_SSE2)
+            if constexpr (sizeof(TElem) == 1ul)
+            {
+                const auto quotes = _mm_set1_epi8(static_cast<char>(quote<TElem>));
+                const auto newLines = _mm_set1_epi8(static_cast<char>(new_line<TElem>));
+                const auto returns = _mm_set1_epi8(static_cast<char>(caridge_return<TElem>));
+                for (; last - first >= 16; first += 16)
+                {
+                    const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quotes)) != 0) { return false; }
 
-        template <typename TAdapter, typename TOut, typename TIn, typename = void>
-        inline constexpr bool is_adapter_v = false;
+                    const auto newLineMask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newLines)));
+                    const auto returnMask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, returns)));
 
-        template <typename TAdapter, typename TOut, typename TIn>
-        inline constexpr bool is_adapter_v<
-            TAdapter,
-            TOut,
-            TIn,
-            std::enable_if_t<std::is_convertible_v<adapter_result_t<TAdapter, TIn>, TOut>>> = true;
+                    // a carriage return followed by a new line ends a single line
+                    const auto nextIsNewLine = (newLineMask >> 1u)
+                                               | (last - first > 16 && first[16] == new_line<TElem> ? 0x8000u : 0u);
+                    const auto endMask = newLineMask | (returnMask & ~nextIsNewLine);
+                    if (endMask != 0u)
+                    {
+                        count += popcount(endMask);
+                        lineStart = first + 64u - leading_zeros(endMask);
+                    }
+                }
+            }
+#endif
+            for (; first != last; ++first)
+            {
+                if (*first == quote<TElem>) { return false; }
 
-#if defined(FASTCSV_HAS_CXX20)
-        template <typename TAdapter, typename TOut, typename TIn>
-        concept adapter = is_adapter_v<TAdapter, TOut, TIn>;
+                if (*first == new_line<TElem>
+                    || (*first == caridge_return<TElem> && (first + 1 == last || first[1] != new_line<TElem>)))
+                {
+                    ++count;
+                    lineStart = first + 1;
+                }
+            }
+            return true;
+        }
 
-        using identity = std::identity;
-#else
-        struct identity
+        // Writes the body of a quoted string [first, last) to dest replacing escaped quotes with a single quote and
+        // returns the end of the written range. Runs between escapes are moved in bulk so dest may alias first
+        template <typename TElem, typename TTraits = std::char_traits<TElem>>
+        inline TElem * unescape(const TElem * first, const TElem * last, TElem * dest) noexcept
         {
-            template <typename T>
-            FASTCSV_CONSTEXPR T && operator()(T && t) const noexcept
+            while (true)
             {
-                return std::forward<T>(t);
-            }
-        };
-#endif
-
-    }  // namespace detail
+                const auto escapePos = find_first<TElem, TTraits>(first, last, escape<TElem>);
+                if (escapePos == last) { break; }
 
-    class fastcsv_exception final : public std::exception
-    {
-    private:
-        std::string what_;
+                const auto runSize = static_cast<size_t>(escapePos + 1 - first);
+                TTraits::move(dest, first, runSize);
+                dest += runSize;
+                first += runSize;
 
-    public:
-        explicit fastcsv_exception(std::string message) noexcept : what_(std::move(message)) { }
+                if (first != last && *first == quote<TElem>)
+                {
+                    dest[-1] = quote<TElem>;
+                    ++first;
+                }
+            }
 
-        const char * what() const noexcept override { return what_.c_str(); }
-    };
+            const auto tailSize = static_cast<size_t>(last - first);
+            TTraits::move(dest, first, tailSize);
+            return dest + tailSize;
+        }
 
-    template <typename TElem, typename TTraits = std::char_traits<TElem>>
-    struct basic_csv_reader
-    {
-        detail::basic_csv_parser<TElem, TTraits> & parser;
+        enum class quoting
+        {
+            // written as is
+            none,
+            // holds a column delimiter or a line end, written inside quotes
+            quote,
+            // holds a quote, written inside quotes with every quote escaped
+            escape
+        };
 
-        template <typename TRead, typename... TArgs>
-        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR inline TRead read(TArgs &&... args) const
+        // Classifies a string for writing in a single pass, stopping at the first quote since nothing needs more
+        template <typename TElem, typename TTraits = std::char_traits<TElem>>
+        FASTCSV_NO_DISCARD inline quoting classify_quoting(const TElem * first, const TElem * last) noexcept
         {
-            if constexpr (std::is_same_v<from_csv<TRead, void, TElem, TTraits>, decltype(*this)>)
+            auto needsQuotes = false;
+
+#if defined(FASTCSV_HAS_SSE2)
+            if constexpr (sizeof(TElem) == 1ul)
             {
-                throw fastcsv_exception(fmt::format("Recursive call  {} {}", __FILE__, __LINE__));
+                const auto quotes = _mm_set1_epi8(static_cast<char>(quote<TElem>));
+                const auto delimiters = _mm_set1_epi8(static_cast<char>(default_column_delimiter<TElem>));
+                const auto newLines = _mm_set1_epi8(static_cast<char>(new_line<TElem>));
+                const auto returns = _mm_set1_epi8(static_cast<char>(caridge_return<TElem>));
+                auto special = _mm_setzero_si128();
+                for (; last - first >= 16; first += 16)
+                {
+                    const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quotes)) != 0) { return quoting::escape; }
+
+                    special = _mm_or_si128(
+                        special,
+                        _mm_or_si128(
+                            _mm_cmpeq_epi8(chunk, delimiters),
+                            _mm_or_si128(_mm_cmpeq_epi8(chunk, newLines), _mm_cmpeq_epi8(chunk, returns))));
+                }
+                needsQuotes = _mm_movemask_epi8(special) != 0;
             }
+#endif
+            for (; first != last; ++first)
+            {
+                if (*first == quote<TElem>) { return quoting::escape; }
 
-            return from_csv<TRead, void, TElem, TTraits>{ parser }(std::forward<TArgs>()...);
+                needsQuotes |= *first == default_column_delimiter<TElem> || *first == new_line<TElem>
+                               || *first == caridge_return<TElem>;
+            }
+            return needsQuotes ? quoting::quote : quoting::none;
         }
 
-        template <typename TRead, typename... TArgs>
-        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR inline std::optional<TRead> read_opt(TArgs &&... args) const
+        // SWAR helpers operate on eight chars loaded into a uint64_t with the first char in the lowest byte
+        FASTCSV_NO_DISCARD inline uint64_t load_eight_chars(const char * chars) noexcept
         {
-            if constexpr (std::is_same_v<from_csv<std::optional<TRead>, void, TElem, TTraits>, decltype(*this)>)
-            {
-                throw fastcsv_exception(fmt::format("Recursive call  {} {}", __FILE__, __LINE__));
-            }
-
-            return from_csv<std::optional<TRead>, void, TElem, TTraits>{ parser }(std::forward<TArgs>(args)...);
+            uint64_t chunk;
+            std::memcpy(&chunk, chars, sizeof(chunk));
+            return chunk;
         }
-    };
-
-    using csv_reader = basic_csv_reader<char>;
 
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool is_eight_digits(uint64_t chunk) noexcept
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0ull) | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+                   == 0x3333333333333333ull;
+        }
 
-    template <typename T, typename TElem, typename TTraits>
-    struct from_csv<T, std::enable_if_t<detail::has_from_chars_integral_v<T>>, TElem, TTraits> final
-      : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline T operator()([[maybe_unused]] const int base = 10) const
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR uint32_t parse_eight_digits(uint64_t chunk) noexcept
         {
-            auto element = this->parser.consume_column();
-            return parse(element);
+            chunk -= 0x3030303030303030ull;
+            chunk = (chunk * 10ull) + (chunk >> 8);
+            chunk = (((chunk & 0x000000FF000000FFull) * (100ull + (1000000ull << 32)))
+                     + (((chunk >> 16) & 0x000000FF000000FFull) * (1ull + (10000ull << 32))))
+                    >> 32;
+            return static_cast<uint32_t>(chunk);
         }
 
-        FASTCSV_NO_DISCARD inline static T parse(std::basic_string_view<TElem, TTraits> element, const int base = 10)
+        // Accumulates the digits [first, last) onto value, at most 19 digits so the result cannot overflow
+        template <typename TElem>
+        FASTCSV_NO_DISCARD inline bool accumulate_digits(
+            const TElem * first, const TElem * last, uint64_t & value) noexcept
         {
-#if defined(FASTCSV_HAS_FROM_CHAR)
-            T result;
-            auto [ptr, errorCode] = std::from_chars(element.data(), element.data() + element.size(), result, base);
-            if (errorCode != std::errc())
-            {
-                throw fastcsv_exception(fmt::format(
-                    "Failed to parse {} from '{}', errorCode: {}  {} {}",
-                    typeid(T).name(),
-                    element,
-                    errorCode,
-                    __FILE__,
-                    __LINE__));
-            }
-            return result;
-#else
-            if constexpr (detail::is_one_of_v<T, char, short, int>)
+#if !defined(FASTCSV_BIG_ENDIAN)
+            if constexpr (sizeof(TElem) == 1ul)
             {
-                return static_cast<T>(std::stoi(std::string(element)));
+                for (; last - first >= 8; first += 8)
+                {
+                    const auto chunk = load_eight_chars(reinterpret_cast<const char *>(first));
+                    if (!is_eight_digits(chunk)) { return false; }
+                    value = value * 100000000ull + parse_eight_digits(chunk);
+                }
             }
-            if constexpr (detail::is_one_of_v<T, unsigned char, unsigned short, unsigned int>)
+#endif
+            for (; first != last; ++first)
             {
-                return static_cast<T>(std::stou(std::string(element)));
+                const auto digit = static_cast<uint64_t>(*first) - static_cast<uint64_t>('0');
+                if (digit > 9ull) { return false; }
+                value = value * 10ull + digit;
             }
-            if constexpr (std::is_same_v<T, long>) { return std::stol(std::string(element)); }
-            if constexpr (std::is_same_v<T, long long>) { return std::stoll(std::string(element)); }
-            if constexpr (std::is_same_v<T, unsigned long>) { return std::stoul(std::string(element)); }
-            if constexpr (std::is_same_v<T, unsigned long long>) { return std::stoull(std::string(element)); }
-#endif
+            return true;
         }
-    };
 
-    template <typename T, typename TElem, typename TTraits>
-    struct from_csv<T, std::enable_if_t<detail::has_from_chars_floating_point_v<T>>, TElem, TTraits> final
-      : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline T operator()(const std::chars_format fmt = std::chars_format::general) const
+        // Range checks a parsed magnitude against T and applies the sign
+        template <typename T>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR std::errc narrow_magnitude(
+            bool negative, uint64_t value, T & result) noexcept
         {
-            auto element = this->parser.consume_column();
-            return parse(element, fmt);
+            using unsigned_t = std::make_unsigned_t<T>;
+            const auto limit = static_cast<uint64_t>(std::numeric_limits<T>::max()) + static_cast<uint64_t>(negative);
+            if (value > limit) { return std::errc::result_out_of_range; }
+
+            result = negative ? static_cast<T>(unsigned_t(0) - static_cast<unsigned_t>(value)) : static_cast<T>(value);
+            return std::errc();
         }
 
-        FASTCSV_NO_DISCARD inline static T parse(
-            std::basic_string_view<TElem, TTraits> element, const std::chars_format fmt = std::chars_format::general)
+        // Parses the whole of [first, last) as a base 10 integer, the field length is already known so there is no
+        // terminator scan and anything other than an optional leading '-' and digits is rejected
+        template <typename T, typename TElem>
+        FASTCSV_NO_DISCARD inline std::errc parse_decimal(const TElem * first, const TElem * last, T & result) noexcept
         {
-#if defined(FASTCSV_HAS_FROM_CHAR)
-            T result;
-            auto [ptr, errorCode] = std::from_chars(element.data(), element.data() + element.size(), result, fmt);
-            if (errorCode != std::errc())
+            static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t));
+
+            const auto negative = std::is_signed_v<T> && first != last && *first == static_cast<TElem>('-');
+            first += static_cast<ptrdiff_t>(negative);
+
+            if (first == last) { return std::errc::invalid_argument; }
+
+            while (last - first > 1 && *first == static_cast<TElem>('0'))
             {
-                throw fastcsv_exception(fmt::format(
-                    "Failed to parse {} from '{}', errorCode: {}  {} {}",
-                    typeid(T).name(),
-                    element,
-                    errorCode,
-                    __FILE__,
-                    __LINE__));
+                ++first;
             }
-            return result;
-#else
-            if constexpr (std::is_same_v<T, float>) { return std::stof(std::string(element)); }
-            if constexpr (std::is_same_v<T, double>) { return std::stod(std::string(element)); }
-            if constexpr (std::is_same_v<T, long double>) { return std::stold(std::string(element)); }
-#endif
-        }
-    };
 
-    template <typename TElem, typename TTraits>
-    struct from_csv<char, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline TElem operator()() const
-        {
-            auto value = this->parser.consume_column();
-            if (value.size() != 1ul)
+            auto digits = last - first;
+            if (digits > 20) { return std::errc::result_out_of_range; }
+
+            auto value = uint64_t{ 0 };
+            auto unchecked = std::min(digits, ptrdiff_t{ 19 });
+            if (!accumulate_digits(first, first + unchecked, value)) { return std::errc::invalid_argument; }
+
+            if (digits == 20)
             {
-                // ToDo:
-                throw fastcsv_exception("");
+                const auto digit = static_cast<uint64_t>(first[19]) - static_cast<uint64_t>('0');
+                if (digit > 9ull) { return std::errc::invalid_argument; }
+                if (value > (UINT64_MAX - digit) / 10ull) { return std::errc::result_out_of_range; }
+                value = value * 10ull + digit;
             }
 
-            return *value.data();
+            return narrow_magnitude(negative, value, result);
         }
-    };
 
-    template <typename TElem, typename TTraits>
-    struct from_csv<std::string, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline std::basic_string<TElem, TTraits> operator()() const
+        // Cheap non-cryptographic hash of a raw field, eight chars at a time where possible
+        template <typename TElem>
+        FASTCSV_NO_DISCARD inline uint64_t hash_field(const TElem * first, const TElem * last) noexcept
         {
-            auto value = this->parser.consume_column();
-            if (value.empty()) { return std::basic_string<TElem, TTraits>(); }
+            constexpr auto multiplier = 0x9E3779B97F4A7C15ull;
 
-            if (value.size() != 1ul
-                && value[0] == detail::quote<TElem> && value[value.size() - 1ul] == detail::quote<TElem>)
+            auto hash = static_cast<uint64_t>(last - first) * multiplier;
+            if constexpr (sizeof(TElem) == 1ul)
             {
-                std::basic_stringstream<TElem, TTraits> ss;
-
-                for (auto pos = 1ul; pos < value.size() - 1ul; ++pos)
+                for (; last - first >= 8; first += 8)
                 {
-                    if (value[pos] == detail::escape<TElem> && value[pos + 1ul] == detail::quote<TElem>)
-                    {
-                        ss << detail::quote<TElem>;
-                        ++pos;
-                    }
-                    else
-                    {
-                        ss << value[pos];
-                    }
+                    hash = (hash ^ load_eight_chars(reinterpret_cast<const char *>(first))) * multiplier;
+                    hash ^= hash >> 29;
                 }
-
-                return ss.str();
             }
-
-            return std::basic_string<TElem, TTraits>(value);
+            for (; first != last; ++first)
+            {
+                hash = (hash ^ static_cast<uint64_t>(*first)) * multiplier;
+            }
+            return hash ^ (hash >> 32);
         }
-    };
 
-    template <typename TElem, typename TTraits>
-    struct from_csv<bool, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline bool operator()() const
+        template <typename TElem, typename TTraits = std::char_traits<TElem>>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool is_quoted(std::basic_string_view<TElem, TTraits> value) noexcept
         {
-            auto value = this->parser.consume_column();
+            return value.size() > 1ul && value.front() == quote<TElem> && value.back() == quote<TElem>;
+        }
+
+
+        template <typename T, typename = void>
+        inline constexpr bool has_from_chars_integral_v = false;
+
+        template <typename T>
+        inline constexpr bool has_from_chars_integral_v<
+            T,
+            std::void_t<decltype(std::from_chars(
+                std::declval<const char *>(),
+                std::declval<const char *>(),
+                std::declval<T &>(),
+                std::declval<const int>()))>> = true;
 
-            if (value == "true" || value == "TRUE" || value == "True" || value == "t") { return true; }
-            if (value == "false" || value == "FALSE" || value == "False" || value == "f") { return false; }
+        template <typename T, typename = void>
+        inline constexpr bool has_from_chars_floating_point_v = false;
+
+        template <typename T>
+        inline constexpr bool has_from_chars_floating_point_v<
+            T,
+            std::void_t<decltype(std::from_chars(
+                std::declval<const char *>(),
+                std::declval<const char *>(),
+                std::declval<T &>(),
+                std::declval<const std::chars_format>()))>> = true;
 
-            throw fastcsv_exception(fmt::format("Unable to parse bool from '{}'  {} {}", value, __FILE__, __LINE__));
+        template <typename T, typename... Ts>
+        constexpr bool is_one_of_v()
+        {
+            return (std::is_same_v<T, Ts> || ...);
         }
-    };
 
-    template <typename T, typename TElem, typename TTraits>
-    struct from_csv<std::optional<T>, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline std::optional<T> operator()() const
+        template <typename TElem>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool is_digit(TElem c) noexcept
         {
-            if (this->parser.current_column_empty())
+            return static_cast<uint32_t>(c) - static_cast<uint32_t>('0') <= 9u;
+        }
+
+        // Consumes digits from first onto value, which wraps silently past 19 digits, and returns the first non-digit
+        template <typename TElem>
+        FASTCSV_NO_DISCARD inline const TElem * consume_digits(
+            const TElem * first, const TElem * last, uint64_t & value) noexcept
+        {
+#if !defined(FASTCSV_BIG_ENDIAN)
+            if constexpr (sizeof(TElem) == 1ul)
             {
-                this->parser.advance_column();
-                return std::nullopt;
+                for (; last - first >= 8; first += 8)
+                {
+                    const auto chunk = load_eight_chars(reinterpret_cast<const char *>(first));
+                    if (!is_eight_digits(chunk)) { break; }
+                    value = value * 100000000ull + parse_eight_digits(chunk);
+                }
             }
-
-            return from_csv<T, void, TElem, TTraits>{ this->parser }();
+#endif
+            for (; first != last && is_digit(*first); ++first)
+            {
+                value = value * 10ull + static_cast<uint64_t>(*first - static_cast<TElem>('0'));
+            }
+            return first;
         }
-    };
 
-#if defined(FASTCSV_HAS_CXX20)
-    template <typename TElem, typename TTraits>
-    struct from_csv<std::chrono::year_month_day, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline std::chrono::year_month_day operator()() const
+        template <typename TElem>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool equals_ignore_case(
+            const TElem * first, const TElem * last, std::string_view lowerCase) noexcept
         {
-            auto element = this->parser.consume_column();
-
-            if (element.size() != 10ul) { throw fastcsv_exception(""); }
-
-            return std::chrono::year_month_day{
-                std::chrono::year(from_csv<int, void, TElem, TTraits>::parse(element.substr(0ul, 4ul))),
-                std::chrono::month(from_csv<int, void, TElem, TTraits>::parse(element.substr(5ul, 2ul))),
-                std::chrono::day(from_csv<int, void, TElem, TTraits>::parse(element.substr(8ul, 2ul)))
-            };
+            if (static_cast<size_t>(last - first) != lowerCase.size()) { return false; }
+            for (auto c : lowerCase)
+            {
+                if ((*first | static_cast<TElem>(0x20)) != static_cast<TElem>(c)) { return false; }
+                ++first;
+            }
+            return true;
         }
-    };
-#endif
-
-    template <typename... Ts>
-    struct from_csv<std::tuple<Ts...>, void, char> final : basic_csv_reader<char>
-    {
-        FASTCSV_NO_DISCARD inline std::tuple<Ts...> operator()() const { return apply<Ts...>(); }
 
-    private:
-        template <typename T, typename... Tss>
-        FASTCSV_NO_DISCARD inline std::tuple<T, Tss...> apply() const
+        // Slow path for long double and hex floats. Where from_chars lacks floating point support it goes through
+        // strtof, strtod and strtold, which follow the decimal point of the global C locale
+        template <typename T, typename TElem>
+        FASTCSV_NO_DISCARD inline std::errc parse_floating_point_fallback(
+            const TElem * first, const TElem * last, T & result, std::chars_format fmt)
         {
-            if constexpr (sizeof...(Tss) == 0ul) { return std::make_tuple<T>(read<T>()); }
+            auto narrow = std::string(static_cast<size_t>(last - first), '\0');
+            std::transform(first, last, narrow.begin(), [](TElem c) { return static_cast<char>(c); });
+
+            if constexpr (has_from_chars_floating_point_v<T>)
+            {
+                auto [ptr, errorCode] = std::from_chars(narrow.data(), narrow.data() + narrow.size(), result, fmt);
+                if (errorCode == std::errc() && ptr != narrow.data() + narrow.size())
+                {
+                    return std::errc::invalid_argument;
+                }
+                return errorCode;
+            }
             else
             {
-                auto leftArg = read<T>();
-                return std::make_tuple<T, Tss...>(std::move(leftArg), std::get<Tss>(apply<Tss...>())...);
+                char * end = nullptr;
+                errno = 0;
+                if constexpr (std::is_same_v<T, float>) { result = std::strtof(narrow.c_str(), &end); }
+                else if constexpr (std::is_same_v<T, double>) { result = std::strtod(narrow.c_str(), &end); }
+                else
+                {
+                    result = std::strtold(narrow.c_str(), &end);
+                }
+
+                if (narrow.empty() || end != narrow.data() + narrow.size()) { return std::errc::invalid_argument; }
+                if (errno == ERANGE) { return std::errc::result_out_of_range; }
+                return std::errc();
             }
         }
-    };
 
-    template <typename T, size_t N, typename TElem, typename TTraits>
-    struct from_csv<std::array<T, N>, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
-    {
-        FASTCSV_NO_DISCARD inline std::array<T, N> operator()() const
+        // Parses the whole of [first, last) as a float or double. Up to 19 significant digits are gathered into a
+        // 64 bit mantissa and converted with Clinger's exact fast path when possible, otherwise with Eisel-Lemire.
+        // When the digits past the 19th decide the rounding the whole decimal is converted with big_decimal, so
+        // decimal input never depends on the locale or allocates
+        template <typename T, typename TElem>
+        FASTCSV_NO_DISCARD inline std::errc parse_floating_point(
+            const TElem * first, const TElem * last, T & result, std::chars_format fmt = std::chars_format::general)
         {
-            auto result = std::array<T, N>{};
-            for (auto i = 0ul; i < N; ++i)
+            static_assert(is_one_of_v<T, float, double>());
+
+            if (fmt == std::chars_format::hex) { return parse_floating_point_fallback(first, last, result, fmt); }
+
+            auto pos = first;
+            const auto negative = pos != last && *pos == static_cast<TElem>('-');
+            pos += static_cast<ptrdiff_t>(negative);
+
+            if (pos == last) { return std::errc::invalid_argument; }
+
+            if (!is_digit(*pos) && *pos != static_cast<TElem>('.'))
             {
-                result[i] = this->template read<T>();
+                if (equals_ignore_case(pos, last, "inf"sv) || equals_ignore_case(pos, last, "infinity"sv))
+                {
+                    result = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+                    return std::errc();
+                }
+                if (equals_ignore_case(pos, last, "nan"sv))
+                {
+                    result = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+                    return std::errc();
+                }
+                return std::errc::invalid_argument;
             }
-            return result;
-        }
-    };
 
-    template <typename TElem, typename TTraits = std::char_traits<TElem>>
-    struct basic_csv_writer
-    {
-        std::basic_ostream<TElem, TTraits> & stream;
-        bool first;
+            auto mantissa = uint64_t{ 0 };
+            const auto integerStart = pos;
+            const auto integerEnd = pos = consume_digits(pos, last, mantissa);
+            auto digitCount = integerEnd - integerStart;
 
-        template <typename TWrite, typename... TArgs>
-        inline void write(const TWrite & value, TArgs &&... args)
-        {
-            if constexpr (std::is_same_v<to_csv<TWrite, void, TElem, TTraits>, decltype(*this)>)
+            auto fractionStart = integerEnd;
+            auto fractionEnd = integerEnd;
+            if (pos != last && *pos == static_cast<TElem>('.'))
             {
-                throw fastcsv_exception(fmt::format("Recursive call  {} {}", __FILE__, __LINE__));
+                fractionStart = pos + 1;
+                fractionEnd = pos = consume_digits(fractionStart, last, mantissa);
+                digitCount += fractionEnd - fractionStart;
             }
 
-            if (!first) { stream << detail::default_column_delimiter<TElem>; }
+            if (digitCount == 0) { return std::errc::invalid_argument; }
 
-            to_csv<TWrite, void, TElem, TTraits>{ stream, true }(value, std::forward<TArgs>(args)...);
+            auto explicitExponent = int64_t{ 0 };
+            if (pos != last && (*pos == static_cast<TElem>('e') || *pos == static_cast<TElem>('E')))
+            {
+                if (fmt == std::chars_format::fixed) { return std::errc::invalid_argument; }
 
-            first = false;
-        }
-    };
+                ++pos;
+                const auto negativeExponent = pos != last && *pos == static_cast<TElem>('-');
+                pos += static_cast<ptrdiff_t>(pos != last && (negativeExponent || *pos == static_cast<TElem>('+')));
 
-    using csv_writer = basic_csv_writer<char>;
+                if (pos == last || !is_digit(*pos)) { return std::errc::invalid_argument; }
 
-    template <typename T, typename TElem, typename TTraits>
-    struct to_csv<
-        T,
-        std::enable_if_t<detail::has_from_chars_integral_v<T> || detail::has_from_chars_floating_point_v<T>>,
-        TElem,
-        TTraits>
-        final : basic_csv_writer<TElem, TTraits>
-    {
-        inline void operator()(T value) { fmt::print(this->stream, "{}", value); }
-        inline void operator()(T value, std::basic_string_view<TElem, TTraits> fmt)
-        {
-            fmt::print(this->stream, fmt, value);
-        }
-    };
+                for (; pos != last && is_digit(*pos); ++pos)
+                {
+                    // saturate, anything this large is out of range regardless of the mantissa
+                    if (explicitExponent < 0x10000)
+                    {
+                        explicitExponent = explicitExponent * 10 + static_cast<int64_t>(*pos - static_cast<TElem>('0'));
+                    }
+                }
 
-    template <typename TElem, typename TTraits>
-    struct to_csv<char, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
-    {
-        inline void operator()(char value) { this->stream << value; }
-    };
+                explicitExponent = negativeExponent ? -explicitExponent : explicitExponent;
+            }
+            else if (fmt == std::chars_format::scientific)
+            {
+                return std::errc::invalid_argument;
+            }
 
-    template <typename TElem, typename TTraits>
-    struct to_csv<std::basic_string<TElem, TTraits>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
-    {
-        inline void operator()(const std::basic_string<TElem, TTraits> & value)
-        {
-            auto hasComma
-                = value.find(detail::default_column_delimiter<TElem>) != std::basic_string<TElem, TTraits>::npos;
-            auto quotePos = value.find(detail::quote<TElem>);
+            if (pos != last) { return std::errc::invalid_argument; }
 
-            if (quotePos != std::basic_string<TElem, TTraits>::npos)
+            auto exponent = explicitExponent - (fractionEnd - fractionStart);
+            auto truncated = false;
+
+            if (digitCount > 19)
             {
-                this->stream << detail::quote<TElem>;
+                // leading zeros are not significant
+                for (auto start = integerStart;
+                     start != fractionEnd && (*start == static_cast<TElem>('0') || *start == static_cast<TElem>('.'));
+                     ++start)
+                {
+                    digitCount -= static_cast<ptrdiff_t>(*start == static_cast<TElem>('0'));
+                }
 
-                size_t startPos = 0ul;
-                do
+                if (digitCount > 19)
                 {
-                    this->stream << std::basic_string_view<TElem, TTraits>(value.data() + startPos, quotePos - startPos)
-                                 << detail::escape<TElem> << detail::quote<TElem>;
+                    constexpr auto minimumNineteenDigits = uint64_t{ 1000000000000000000ull };
 
-                    startPos = quotePos + 1ul;
-                    quotePos = value.find(detail::quote<TElem>, startPos);
-                }
-                while (quotePos != std::basic_string<TElem, TTraits>::npos);
+                    truncated = true;
+                    mantissa = 0ull;
+                    pos = integerStart;
+                    for (; mantissa < minimumNineteenDigits && pos != integerEnd; ++pos)
+                    {
+                        mantissa = mantissa * 10ull + static_cast<uint64_t>(*pos - static_cast<TElem>('0'));
+                    }
 
-                this->stream << std::basic_string_view<TElem, TTraits>(value.data() + startPos, value.size() - startPos)
-                             << detail::quote<TElem>;
+                    if (mantissa >= minimumNineteenDigits) { exponent = (integerEnd - pos) + explicitExponent; }
+                    else
+                    {
+                        for (pos = fractionStart; mantissa < minimumNineteenDigits && pos != fractionEnd; ++pos)
+                        {
+                            mantissa = mantissa * 10ull + static_cast<uint64_t>(*pos - static_cast<TElem>('0'));
+                        }
+                        exponent = (fractionStart - pos) + explicitExponent;
+                    }
+                }
             }
-            else if (hasComma)
+
+            if (!truncated && try_exact_conversion(negative, exponent, mantissa, result)) { return std::errc(); }
+
+            auto adjusted = compute_float<T>(exponent, mantissa);
+            if (truncated && adjusted != compute_float<T>(exponent, mantissa + 1ull))
             {
-                this->stream << detail::quote<TElem> << value << detail::quote<TElem>;
+                adjusted = big_decimal(integerStart, integerEnd, fractionStart, fractionEnd, explicitExponent)
+                               .to_binary<T>();
             }
-            else
+
+            if (mantissa != 0ull
+                && ((adjusted.power2 == 0 && adjusted.mantissa == 0ull)
+                    || adjusted.power2 == binary_format<T>::infinite_power))
             {
-                this->stream << value;
+                return std::errc::result_out_of_range;
             }
-        }
-    };
 
-    template <typename TElem, typename TTraits>
-    struct to_csv<bool, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
-    {
-        inline void operator()(bool value) { fmt::print(this->stream, value ? "true" : "false"); }
-    };
+            result = to_floating_point<T>(negative, adjusted);
+            return std::errc();
+        }
 
-    template <typename T, typename TElem, typename TTraits>
-    struct to_csv<std::optional<T>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
-    {
-        inline void operator()(const std::optional<T> & value)
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR uint64_t power_of_ten(unsigned exponent) noexcept
         {
-            if (!value) { return; }
-
-            to_csv<T, void, TElem, TTraits>{ this->stream, this->first }(*value);
+            auto value = uint64_t{ 1 };
+            while (exponent-- != 0u)
+            {
+                value *= 10ull;
+            }
+            return value;
         }
-    };
 
-#if defined(FASTCSV_HAS_CXX20)
-    template <typename TElem, typename TTraits>
-    struct to_csv<std::chrono::year_month_day, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
-    {
-        inline void operator()(std::chrono::year_month_day value)
+        // Parses the whole of [first, last) as a decimal with at most Scale fractional digits into a value scaled by
+        // 10^Scale. Further fractional digits are only accepted when they are zeros, other digits are an invalid
+        // argument since dropping them is inexact
+        template <unsigned Scale, typename Rep, typename TElem>
+        FASTCSV_NO_DISCARD inline std::errc parse_fixed_point(
+            const TElem * first, const TElem * last, Rep & result) noexcept
         {
-            fmt::print(
-                this->stream,
-                "{}-{}-{}",
-                value.year().operator int(),
-                value.month().operator unsigned int(),
-                value.day().operator unsigned int());
-        }
-    };
-#endif
+            const auto negative = std::is_signed_v<Rep> && first != last && *first == static_cast<TElem>('-');
+            first += static_cast<ptrdiff_t>(negative);
 
-    template <typename... Ts>
-    struct to_csv<std::tuple<Ts...>, void> final : csv_writer
-    {
-        inline void operator()(const std::tuple<Ts...> & value) { apply(value); }
+            auto integerStart = first;
+            auto value = uint64_t{ 0 };
+            const auto integerEnd = consume_digits(integerStart, last, value);
 
-    private:
-        template <size_t I = 0u, typename... Tss>
-        inline void apply(const std::tuple<Tss...> & value)
-        {
-            if constexpr (I == sizeof...(Tss)) { return; }
-            else
+            auto fractionStart = integerEnd;
+            auto fractionEnd = integerEnd;
+            if (fractionEnd != last && *fractionEnd == static_cast<TElem>('.'))
             {
-                write(std::get<I>(value));
-                apply<I + 1u, Tss...>(value);
+                fractionStart = integerEnd + 1;
+                fractionEnd = fractionStart;
+                while (fractionEnd != last && is_digit(*fractionEnd))
+                {
+                    ++fractionEnd;
+                }
             }
-        }
-    };
 
-    template <typename T, size_t N, typename TElem, typename TTraits>
-    struct to_csv<std::array<T, N>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
-    {
-        inline void operator()(const std::array<T, N> & value)
-        {
-            for (auto i = 0ul; i < N; ++i)
+            if (fractionEnd != last || (integerStart == integerEnd && fractionStart == fractionEnd))
             {
-                this->template write<T>(value[i]);
+                return std::errc::invalid_argument;
             }
-        }
-    };
 
-    namespace detail
-    {
-
-        template <size_t I = 0ul, typename... Ts>
-        void read_line(csv_parser & parser, std::tuple<std::vector<Ts>...> & vectors)
-        {
-            if constexpr (I == sizeof...(Ts)) { return; }
-            else
+            if (fractionEnd - fractionStart > static_cast<ptrdiff_t>(Scale))
             {
-                auto & vec = std::get<I>(vectors);
-                using value_type = typename std::remove_reference_t<decltype(vec)>::value_type;
-                vec.emplace_back(from_csv<value_type>{ parser }());
+                const auto isNonZero = [](TElem c) { return c != static_cast<TElem>('0'); };
+                if (std::any_of(fractionStart + Scale, fractionEnd, isNonZero)) { return std::errc::invalid_argument; }
+                fractionEnd = fractionStart + Scale;
+            }
 
-                read_line<I + 1ul, Ts...>(parser, vectors);
+            while (integerStart != integerEnd && *integerStart == static_cast<TElem>('0'))
+            {
+                ++integerStart;
             }
-        }
 
-        template <typename T, std::enable_if_t<!std::is_same_v<T, void>> * = nullptr>
-        void write_line(std::ostream & stream, const std::vector<T> & vector, size_t index, bool & first)
-        {
-            to_csv<T>{ stream, first }.write(vector[index]);
-            first = false;
-        }
+            // 19 digits always fit in the uint64_t accumulator, a 20th may and is checked
+            const auto digits = (integerEnd - integerStart) + static_cast<ptrdiff_t>(Scale);
+            if (digits > 20) { return std::errc::result_out_of_range; }
 
-        struct no_header_tag
-        {
+            const auto factor = power_of_ten(Scale - static_cast<unsigned>(fractionEnd - fractionStart));
+            value = 0ull;
+            if (digits < 20)
+            {
+                (void)consume_digits(integerStart, integerEnd, value);
+                (void)consume_digits(fractionStart, fractionEnd, value);
+                value *= factor;
+            }
+            else
+            {
+                const auto append = [&value](const TElem * digit, const TElem * end) noexcept {
+                    for (; digit != end; ++digit)
+                    {
+                        const auto next = static_cast<uint64_t>(*digit - static_cast<TElem>('0'));
+                        if (value > (UINT64_MAX - next) / 10ull) { return false; }
+                        value = value * 10ull + next;
+                    }
+                    return true;
+                };
+                if (!append(integerStart, integerEnd) || !append(fractionStart, fractionEnd)
+                    || value > UINT64_MAX / factor)
+                {
+                    return std::errc::result_out_of_range;
+                }
+                value *= factor;
+            }
+
+            return narrow_magnitude(negative, value, result);
+        }
+
+        // Formats a value scaled by 10^Scale with exactly Scale fractional digits, buffer must hold at least 22 chars
+        template <unsigned Scale, typename Rep, typename TElem>
+        inline TElem * format_fixed_point(Rep value, TElem * buffer) noexcept
+        {
+            using unsigned_t = std::make_unsigned_t<Rep>;
+
+            auto magnitude = static_cast<uint64_t>(static_cast<unsigned_t>(value));
+            if (value < Rep(0))
+            {
+                magnitude = static_cast<uint64_t>(unsigned_t(0) - static_cast<unsigned_t>(value));
+                *buffer++ = static_cast<TElem>('-');
+            }
+
+            TElem digits[20];
+            auto end = digits + 20;
+            auto pos = end;
+            do
+            {
+                *--pos = static_cast<TElem>('0' + magnitude % 10ull);
+                magnitude /= 10ull;
+            }
+            while (magnitude != 0ull || end - pos <= static_cast<ptrdiff_t>(Scale));
+
+            auto integerEnd = end - Scale;
+            buffer = std::copy(pos, integerEnd, buffer);
+            if constexpr (Scale != 0u)
+            {
+                *buffer++ = static_cast<TElem>('.');
+                buffer = std::copy(integerEnd, end, buffer);
+            }
+            return buffer;
+        }
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool is_leap_year(int64_t year) noexcept
+        {
+            return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+        }
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool is_valid_civil_date(
+            int64_t year, unsigned month, unsigned day) noexcept
+        {
+            constexpr unsigned char daysInMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+            return month - 1u < 12u && day != 0u
+                   && day <= daysInMonth[month - 1u] + static_cast<unsigned>(month == 2u && is_leap_year(year));
+        }
+
+        // Days since 1970-01-01 for a proleptic gregorian date: http://howardhinnant.github.io/date_algorithms.html
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR int64_t days_from_civil(
+            int64_t year, unsigned month, unsigned day) noexcept
+        {
+            year -= static_cast<int64_t>(month <= 2u);
+            const auto era = (year >= 0 ? year : year - 399) / 400;
+            const auto yearOfEra = static_cast<unsigned>(year - era * 400);
+            const auto dayOfYear = (153u * (month > 2u ? month - 3u : month + 9u) + 2u) / 5u + day - 1u;
+            const auto dayOfEra = yearOfEra * 365u + yearOfEra / 4u - yearOfEra / 100u + dayOfYear;
+            return era * 146097 + static_cast<int64_t>(dayOfEra) - 719468;
+        }
+
+        FASTCSV_CONSTEXPR void civil_from_days(int64_t days, int64_t & year, unsigned & month, unsigned & day) noexcept
+        {
+            days += 719468;
+            const auto era = (days >= 0 ? days : days - 146096) / 146097;
+            const auto dayOfEra = static_cast<unsigned>(days - era * 146097);
+            const auto yearOfEra = (dayOfEra - dayOfEra / 1460u + dayOfEra / 36524u - dayOfEra / 146096u) / 365u;
+            const auto dayOfYear = dayOfEra - (365u * yearOfEra + yearOfEra / 4u - yearOfEra / 100u);
+            const auto monthIndex = (5u * dayOfYear + 2u) / 153u;
+            day = dayOfYear - (153u * monthIndex + 2u) / 5u + 1u;
+            month = monthIndex < 10u ? monthIndex + 3u : monthIndex - 9u;
+            year = static_cast<int64_t>(yearOfEra) + era * 400 + static_cast<int64_t>(month <= 2u);
+        }
+
+        template <typename TElem>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR unsigned two_digits(const TElem * chars) noexcept
+        {
+            return static_cast<unsigned>(chars[0] - static_cast<TElem>('0')) * 10u
+                   + static_cast<unsigned>(chars[1] - static_cast<TElem>('0'));
+        }
+
+        // Checks chars against an ISO 8601 layout where 'd' matches any digit and other chars match themselves
+        template <typename TElem>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool matches_layout(const TElem * chars, std::string_view layout) noexcept
+        {
+            for (auto expected : layout)
+            {
+                if (expected == 'd' ? !is_digit(*chars) : *chars != static_cast<TElem>(expected)) { return false; }
+                ++chars;
+            }
+            return true;
+        }
+
+        // Validates and converts the ten chars "YYYY-MM-DD" at first
+        template <typename TElem>
+        FASTCSV_NO_DISCARD inline std::errc parse_iso8601_date(
+            const TElem * first, int64_t & year, unsigned & month, unsigned & day) noexcept
+        {
+            if (!matches_layout(first, "dddd-dd-dd"sv)) { return std::errc::invalid_argument; }
+
+            year = static_cast<int64_t>(two_digits(first) * 100u + two_digits(first + 2));
+            month = two_digits(first + 5);
+            day = two_digits(first + 8);
+
+            return is_valid_civil_date(year, month, day) ? std::errc() : std::errc::invalid_argument;
+        }
+
+        // Parses "YYYY-MM-DD", "YYYY-MM-DDTHH:MM:SS" or "YYYY-MM-DDTHH:MM:SS.f" with up to nine fractional digits, a
+        // space may replace the 'T' and a trailing 'Z' is accepted. The fixed layout is validated in one SIMD compare
+        template <typename TElem>
+        FASTCSV_NO_DISCARD inline std::errc parse_iso8601(
+            const TElem * first, const TElem * last, int64_t & seconds, uint32_t & nanoseconds) noexcept
+        {
+            constexpr auto dateSize = ptrdiff_t{ 10 };
+            constexpr auto dateTimeSize = ptrdiff_t{ 19 };
+
+            if (last != first && last[-1] == static_cast<TElem>('Z')) { --last; }
+
+            const auto size = last - first;
+            if (size != dateSize && size < dateTimeSize) { return std::errc::invalid_argument; }
+
+            nanoseconds = 0u;
+            if (size == dateSize)
+            {
+                auto year = int64_t{ 0 };
+                auto month = 0u;
+                auto day = 0u;
+                const auto errorCode = parse_iso8601_date(first, year, month, day);
+                seconds = days_from_civil(year, month, day) * 86400;
+                return errorCode;
+            }
+
+            const auto separator = first[10];
+            if (separator != static_cast<TElem>('T') && separator != static_cast<TElem>(' '))
+            {
+                return std::errc::invalid_argument;
+            }
+
+#if defined(FASTCSV_HAS_SSE2)
+            if constexpr (sizeof(TElem) == 1ul)
+            {
+                // "YYYY-MM-DDTHH:MM" in lanes 0-15, the separator in lane 10 is checked above
+                constexpr auto digitLanes = 0xDB6Fu;
+                constexpr auto punctuationLanes = 0x2090u;
+
+                const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first));
+                const auto values = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+                const auto isDigit = _mm_cmpeq_epi8(_mm_max_epu8(values, _mm_set1_epi8(9)), _mm_set1_epi8(9));
+                const auto punctuation = _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 0, 0, 0, ':', 0, 0);
+                const auto isPunctuation = _mm_cmpeq_epi8(chunk, punctuation);
+
+                if ((static_cast<unsigned>(_mm_movemask_epi8(isDigit)) & digitLanes) != digitLanes
+                    || (static_cast<unsigned>(_mm_movemask_epi8(isPunctuation)) & punctuationLanes) != punctuationLanes
+                    || !matches_layout(first + 16, ":dd"sv))
+                {
+                    return std::errc::invalid_argument;
+                }
+            }
+            else
+#endif
+            {
+                if (!matches_layout(first, "dddd-dd-dd"sv) || !matches_layout(first + 11, "dd:dd:dd"sv))
+                {
+                    return std::errc::invalid_argument;
+                }
+            }
+
+            const auto year = static_cast<int64_t>(two_digits(first) * 100u + two_digits(first + 2));
+            const auto month = two_digits(first + 5);
+            const auto day = two_digits(first + 8);
+            const auto hour = two_digits(first + 11);
+            const auto minute = two_digits(first + 14);
+            const auto second = two_digits(first + 17);
+
+            if (!is_valid_civil_date(year, month, day) || hour > 23u || minute > 59u || second > 59u)
+            {
+                return std::errc::invalid_argument;
+            }
+
+            if (size > dateTimeSize)
+            {
+                const auto fractionSize = size - dateTimeSize - 1;
+                if (first[dateTimeSize] != static_cast<TElem>('.') || fractionSize < 1 || fractionSize > 9)
+                {
+                    return std::errc::invalid_argument;
+                }
+
+                for (auto pos = first + dateTimeSize + 1; pos != last; ++pos)
+                {
+                    if (!is_digit(*pos)) { return std::errc::invalid_argument; }
+                    nanoseconds = nanoseconds * 10u + static_cast<uint32_t>(*pos - static_cast<TElem>('0'));
+                }
+                nanoseconds *= static_cast<uint32_t>(power_of_ten(static_cast<unsigned>(9 - fractionSize)));
+            }
+
+            seconds = days_from_civil(year, month, day) * 86400
+                      + static_cast<int64_t>(hour * 3600u + minute * 60u + second);
+            return std::errc();
+        }
+
+        template <typename TElem>
+        inline TElem * format_digits(uint64_t value, unsigned width, TElem * buffer) noexcept
+        {
+            auto end = buffer + width;
+            for (auto pos = end; pos != buffer; value /= 10ull)
+            {
+                *--pos = static_cast<TElem>('0' + value % 10ull);
+            }
+            return end;
+        }
+
+        // "00" to "99" back to back, formatting two digits per division halves the divisions of a digit loop
+        inline constexpr char digit_pairs[] = "0001020304050607080910111213141516171819"
+                                              "2021222324252627282930313233343536373839"
+                                              "4041424344454647484950515253545556575859"
+                                              "6061626364656667686970717273747576777879"
+                                              "8081828384858687888990919293949596979899";
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR unsigned count_digits(uint64_t value) noexcept
+        {
+            auto digits = 1u;
+            for (;;)
+            {
+                if (value < 10ull) { return digits; }
+                if (value < 100ull) { return digits + 1u; }
+                if (value < 1000ull) { return digits + 2u; }
+                if (value < 10000ull) { return digits + 3u; }
+                value /= 10000ull;
+                digits += 4u;
+            }
+        }
+
+        // Writes the decimal digits of value, buffer must hold at least 20 elements
+        template <typename TElem>
+        inline TElem * format_unsigned(uint64_t value, TElem * buffer) noexcept
+        {
+            auto end = buffer + count_digits(value);
+            auto pos = end;
+            while (value >= 100ull)
+            {
+                const auto pair = static_cast<size_t>(value % 100ull) * 2ul;
+                value /= 100ull;
+                *--pos = static_cast<TElem>(digit_pairs[pair + 1ul]);
+                *--pos = static_cast<TElem>(digit_pairs[pair]);
+            }
+
+            if (value >= 10ull)
+            {
+                *--pos = static_cast<TElem>(digit_pairs[value * 2ull + 1ull]);
+                *--pos = static_cast<TElem>(digit_pairs[value * 2ull]);
+            }
+            else
+            {
+                *--pos = static_cast<TElem>('0' + value);
+            }
+            return end;
+        }
+
+        // Writes value in base 10, buffer must hold at least 21 elements
+        template <typename T, typename TElem>
+        inline TElem * format_integer(T value, TElem * buffer) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                if (value < T(0))
+                {
+                    *buffer++ = static_cast<TElem>('-');
+                    return format_unsigned(uint64_t{ 0 } - static_cast<uint64_t>(value), buffer);
+                }
+            }
+            return format_unsigned(static_cast<uint64_t>(value), buffer);
+        }
+
+        // Writes "YYYY-MM-DD", years outside [0, 9999] keep their sign and all their digits
+        template <typename TElem>
+        inline TElem * format_iso8601_date(int64_t year, unsigned month, unsigned day, TElem * buffer) noexcept
+        {
+            if (year < 0 || year > 9999)
+            {
+                if (year < 0) { *buffer++ = static_cast<TElem>('-'); }
+                const auto magnitude = static_cast<uint64_t>(year < 0 ? -year : year);
+                auto width = 4u;
+                while (width < 20u && power_of_ten(width) <= magnitude)
+                {
+                    ++width;
+                }
+                buffer = format_digits(magnitude, width, buffer);
+            }
+            else
+            {
+                buffer = format_digits(static_cast<uint64_t>(year), 4u, buffer);
+            }
+
+            *buffer++ = static_cast<TElem>('-');
+            buffer = format_digits(month, 2u, buffer);
+            *buffer++ = static_cast<TElem>('-');
+            return format_digits(day, 2u, buffer);
+        }
+
+        // Writes "YYYY-MM-DDTHH:MM:SS" for a count of seconds since the epoch
+        template <typename TElem>
+        inline TElem * format_iso8601(int64_t seconds, TElem * buffer) noexcept
+        {
+            auto days = seconds / 86400;
+            auto secondOfDay = seconds % 86400;
+            if (secondOfDay < 0)
+            {
+                --days;
+                secondOfDay += 86400;
+            }
+
+            auto year = int64_t{ 0 };
+            auto month = 0u;
+            auto day = 0u;
+            civil_from_days(days, year, month, day);
+
+            buffer = format_iso8601_date(year, month, day, buffer);
+            *buffer++ = static_cast<TElem>('T');
+            buffer = format_digits(static_cast<uint64_t>(secondOfDay / 3600), 2u, buffer);
+            *buffer++ = static_cast<TElem>(':');
+            buffer = format_digits(static_cast<uint64_t>(secondOfDay / 60 % 60), 2u, buffer);
+            *buffer++ = static_cast<TElem>(':');
+            return format_digits(static_cast<uint64_t>(secondOfDay % 60), 2u, buffer);
+        }
+
+        template <typename TElem>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR uint64_t seeded_hash(
+            const TElem * chars, size_t size, uint64_t seed) noexcept
+        {
+            auto hash = seed ^ 0xCBF29CE484222325ull;
+            for (auto i = 0ul; i < size; ++i)
+            {
+                hash = (hash ^ static_cast<uint64_t>(static_cast<std::make_unsigned_t<TElem>>(chars[i])))
+                       * 0x100000001B3ull;
+            }
+            return hash ^ (hash >> 29);
+        }
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t next_power_of_two(size_t value) noexcept
+        {
+            auto result = size_t{ 1 };
+            while (result < value)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        template <typename T>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR int64_t to_underlying(T value) noexcept
+        {
+            if constexpr (std::is_enum_v<T>)
+            {
+                return static_cast<int64_t>(static_cast<std::underlying_type_t<T>>(value));
+            }
+            else
+            {
+                return static_cast<int64_t>(value);
+            }
+        }
+
+        // Compile time tables for an enum_mapping: a collision free hash of every name for parsing, found by searching
+        // for a seed, and a dense value to name table for writing when the values span a small range
+        template <typename T>
+        struct enum_table
+        {
+            static constexpr auto & values = enum_mapping<T>::values;
+            static constexpr size_t count = std::size(values);
+            static constexpr size_t capacity = next_power_of_two(count) * 4ul;
+
+            static_assert(count != 0ul, "enum_mapping values must not be empty");
+            static_assert(count < 0xFFFFul, "enum_mapping values has too many entries");
+
+            static constexpr bool is_collision_free(uint64_t seed) noexcept
+            {
+                bool used[capacity] = {};
+                for (const auto & [name, value] : values)
+                {
+                    auto & slot = used[seeded_hash(name.data(), name.size(), seed) & (capacity - 1ul)];
+                    if (slot) { return false; }
+                    slot = true;
+                }
+                return true;
+            }
+
+            static constexpr uint64_t find_seed() noexcept
+            {
+                for (auto seed = uint64_t{ 0 }; seed < 10000ull; ++seed)
+                {
+                    if (is_collision_free(seed)) { return seed; }
+                }
+                return UINT64_MAX;
+            }
+
+            static constexpr uint64_t seed = find_seed();
+            static_assert(seed != UINT64_MAX, "enum_mapping names must be unique");
+
+            // index into values plus one, zero marks an empty slot
+            static constexpr std::array<uint16_t, capacity> slots = []() {
+                auto result = std::array<uint16_t, capacity>{};
+                for (auto i = 0ul; i < count; ++i)
+                {
+                    const auto & name = values[i].first;
+                    const auto index = seeded_hash(name.data(), name.size(), seed) & (capacity - 1ul);
+                    result[index] = static_cast<uint16_t>(i + 1ul);
+                }
+                return result;
+            }();
+
+            static constexpr int64_t min_value = []() {
+                auto result = to_underlying(values[0].second);
+                for (const auto & [name, value] : values)
+                {
+                    result = std::min(result, to_underlying(value));
+                }
+                return result;
+            }();
+
+            static constexpr int64_t max_value = []() {
+                auto result = to_underlying(values[0].second);
+                for (const auto & [name, value] : values)
+                {
+                    result = std::max(result, to_underlying(value));
+                }
+                return result;
+            }();
+
+            static constexpr size_t max_name_size = []() {
+                auto result = 0ul;
+                for (const auto & [name, value] : values)
+                {
+                    result = std::max(result, name.size());
+                }
+                return result;
+            }();
+
+            // names written without quoting
+            static constexpr bool names_are_plain = []() {
+                for (const auto & [name, value] : values)
+                {
+                    for (auto c : name)
+                    {
+                        if (c == default_column_delimiter<char> || c == quote<char> || c == new_line<char>
+                            || c == caridge_return<char>)
+                        {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }();
+
+            static constexpr bool is_dense = static_cast<uint64_t>(max_value - min_value) < 256ull;
+            static constexpr size_t dense_size = is_dense ? static_cast<size_t>(max_value - min_value) + 1ul : 0ul;
+
+            static constexpr std::array<std::string_view, dense_size> names = []() {
+                auto result = std::array<std::string_view, dense_size>{};
+                for (auto i = count; i-- != 0ul;)
+                {
+                    if constexpr (is_dense)
+                    {
+                        result[static_cast<size_t>(to_underlying(values[i].second) - min_value)] = values[i].first;
+                    }
+                }
+                return result;
+            }();
+
+            template <typename TElem, typename TTraits>
+            FASTCSV_NO_DISCARD static inline const T * find(std::basic_string_view<TElem, TTraits> name) noexcept
+            {
+                const auto slot = slots[seeded_hash(name.data(), name.size(), seed) & (capacity - 1ul)];
+                if (slot == 0u) { return nullptr; }
+
+                const auto & entry = values[slot - 1u];
+                if (entry.first.size() != name.size()
+                    || !std::equal(name.begin(), name.end(), entry.first.begin(), [](TElem lhs, char rhs) {
+                           return lhs == static_cast<TElem>(rhs);
+                       }))
+                {
+                    return nullptr;
+                }
+                return &entry.second;
+            }
+
+            FASTCSV_NO_DISCARD static inline std::string_view name(T value) noexcept
+            {
+                if constexpr (is_dense)
+                {
+                    const auto offset = static_cast<uint64_t>(to_underlying(value) - min_value);
+                    return offset < dense_size ? names[offset] : std::string_view();
+                }
+                else
+                {
+                    for (const auto & [name, mapped] : values)
+                    {
+                        if (mapped == value) { return name; }
+                    }
+                    return std::string_view();
+                }
+            }
+        };
+
+        template <
+            size_t INDEX = 0u,
+            typename TTuple,
+            size_t SIZE = std::tuple_size_v<std::remove_reference_t<TTuple>>,
+            typename TCallable,
+            typename... TArgs>
+        void for_each(TTuple && tuple, TCallable && callable, TArgs &&... args)
+        {
+            if constexpr (INDEX >= SIZE) { return; }
+            else
+            {
+                std::invoke(callable, args..., std::get<INDEX>(tuple));
+                for_each<INDEX + 1ul>(
+                    std::forward<TTuple>(tuple),
+                    std::forward<TCallable>(callable),
+                    std::forward<TArgs>(args)...);
+            }
+        }
+
+        template <typename... Ts>
+        std::tuple<std::vector<Ts>...> make_reserved_vectors(size_t size)
+        {
+            auto vectors = std::tuple<std::vector<Ts>...>();
+            for_each(
+                vectors,
+                [](size_t size, auto & vec) { vec.reserve(size); },
+                size);
+            return vectors;
+        }
+
+        template <typename TAdapter, typename TIn>
+        using adapter_result_t = std::invoke_result_t<TAdapter, TIn>;
+
+        template <typename TAdapter, typename TOut, typename TIn, typename = void>
+        inline constexpr bool is_adapter_v = false;
+
+        template <typename TAdapter, typename TOut, typename TIn>
+        inline constexpr bool is_adapter_v<
+            TAdapter,
+            TOut,
+            TIn,
+            std::enable_if_t<std::is_convertible_v<adapter_result_t<TAdapter, TIn>, TOut>>> = true;
+
+#if defined(FASTCSV_HAS_CXX20)
+        template <typename TAdapter, typename TOut, typename TIn>
+        concept adapter = is_adapter_v<TAdapter, TOut, TIn>;
+
+        using identity = std::identity;
+#else
+        struct identity
+        {
+            template <typename T>
+            FASTCSV_CONSTEXPR T && operator()(T && t) const noexcept
+            {
+                return std::forward<T>(t);
+            }
+        };
+#endif
+
+        template <typename T>
+        inline constexpr bool is_std_array_v = false;
+
+        template <typename T, size_t N>
+        inline constexpr bool is_std_array_v<std::array<T, N>> = true;
+
+        // Aggregates without their own from_csv or to_csv are mapped member by member, std::array and enum_mapping
+        // types keep their dedicated specialisations. Aggregates with base classes or C array members cannot be bound
+        // member by member and get no mapping
+        template <typename T, typename = void>
+        inline constexpr bool is_csv_aggregate_v = false;
+
+        template <typename T>
+        inline constexpr bool is_csv_aggregate_v<
+            T,
+            std::enable_if_t<
+                std::is_aggregate_v<T> && !std::is_array_v<T> && !is_std_array_v<T> && !has_enum_mapping<T>>>
+            = aggregate_arity_v<T> != 0ul && is_member_wise_aggregate_v<T>;
+
+        template <typename TMembers>
+        inline constexpr bool members_have_from_csv_v = false;
+
+        template <typename... Ts>
+        inline constexpr bool members_have_from_csv_v<std::tuple<Ts...>> = (has_from_csv<Ts> && ...);
+
+        template <typename TMembers>
+        inline constexpr bool members_have_to_csv_v = false;
+
+        template <typename... Ts>
+        inline constexpr bool members_have_to_csv_v<std::tuple<Ts...>> = (has_to_csv<Ts> && ...);
+
+        template <typename T, typename = void>
+        inline constexpr bool is_readable_aggregate_v = false;
+
+        template <typename T>
+        inline constexpr bool is_readable_aggregate_v<T, std::enable_if_t<is_csv_aggregate_v<T>>>
+            = members_have_from_csv_v<aggregate_members_t<T>>;
+
+        template <typename T, typename = void>
+        inline constexpr bool is_writable_aggregate_v = false;
+
+        template <typename T>
+        inline constexpr bool is_writable_aggregate_v<T, std::enable_if_t<is_csv_aggregate_v<T>>>
+            = members_have_to_csv_v<aggregate_members_t<T>>;
+
+    }  // namespace detail
+
+    /// Exact fixed point decimal stored as an integer count of 10^-Scale units, e.g. decimal<4> holds 123.45 as 1234500
+    template <unsigned Scale, typename Rep = int64_t>
+    class decimal
+    {
+        static_assert(std::is_integral_v<Rep> && sizeof(Rep) <= sizeof(uint64_t), "Rep must be an integer type");
+        static_assert(Scale <= 19u, "Scale must be at most 19 to fit a 64 bit representation");
+        static_assert(
+            detail::power_of_ten(Scale) <= static_cast<uint64_t>(std::numeric_limits<Rep>::max()),
+            "10^Scale must fit in Rep");
+
+    public:
+        using rep = Rep;
+
+        static constexpr unsigned scale = Scale;
+        static constexpr Rep scale_factor = static_cast<Rep>(detail::power_of_ten(Scale));
+
+    private:
+        Rep value_;
+
+    public:
+        FASTCSV_CONSTEXPR decimal() noexcept : value_(0) { }
+
+        FASTCSV_NO_DISCARD static FASTCSV_CONSTEXPR decimal from_raw(Rep value) noexcept
+        {
+            auto result = decimal();
+            result.value_ = value;
+            return result;
+        }
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR Rep raw() const noexcept { return value_; }
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR double to_double() const noexcept
+        {
+            return static_cast<double>(value_) / static_cast<double>(scale_factor);
+        }
+
+        FASTCSV_CONSTEXPR bool operator==(decimal other) const noexcept { return value_ == other.value_; }
+        FASTCSV_CONSTEXPR bool operator!=(decimal other) const noexcept { return value_ != other.value_; }
+        FASTCSV_CONSTEXPR bool operator<(decimal other) const noexcept { return value_ < other.value_; }
+        FASTCSV_CONSTEXPR bool operator<=(decimal other) const noexcept { return value_ <= other.value_; }
+        FASTCSV_CONSTEXPR bool operator>(decimal other) const noexcept { return value_ > other.value_; }
+        FASTCSV_CONSTEXPR bool operator>=(decimal other) const noexcept { return value_ >= other.value_; }
+    };
+
+    class fastcsv_exception : public std::exception
+    {
+    private:
+        std::string what_;
+        size_t offset_;
+
+    public:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        explicit fastcsv_exception(std::string message, size_t offset = npos) noexcept
+          : what_(std::move(message))
+          , offset_(offset)
+        { }
+
+        const char * what() const noexcept override { return what_.c_str(); }
+
+        /// Byte offset of the failing field within the content given to read_csv or read_csv_v, npos when unknown
+        FASTCSV_NO_DISCARD size_t offset() const noexcept { return offset_; }
+    };
+
+    /// Thrown when a field does not convert to its type. The skip and collect error policies record these against
+    /// the field, as well as std::invalid_argument and std::out_of_range, other exceptions end the read. Throw it from
+    /// a from_csv of your own for a field it cannot convert
+    class conversion_error final : public fastcsv_exception
+    {
+    public:
+        using fastcsv_exception::fastcsv_exception;
+    };
+
+    /// How read_csv, load_csv and read_csv_v handle a row that fails to convert
+    enum class error_policy
+    {
+        /// throw a fastcsv_exception from the failing conversion
+        throw_exception,
+        /// drop the row
+        skip,
+        /// drop the row and append a csv_error
+        collect,
+        /// append a csv_error and stop reading, the rows before it are returned
+        abort
+    };
+
+    /// A row that failed to convert, the message is only formatted when asked for
+    struct csv_error
+    {
+        /// zero based line of the row within the content, the header is line zero when present
+        size_t row;
+        /// zero based column of the first failing field
+        size_t column;
+        /// byte offset of the first failing field within the content
+        size_t offset;
+        std::errc code;
+
+        FASTCSV_NO_DISCARD std::string message() const
+        {
+            return fmt::format(
+                "Failed to convert column {} of row {} at offset {}, errorCode: {}",
+                column,
+                row,
+                offset,
+                std::make_error_code(code).message());
+        }
+    };
+
+    /// Zero based line and column of a byte offset within csv content. Lines count records, so a quoted field that
+    /// spans several lines stays on the line it starts on
+    struct csv_location
+    {
+        size_t line;
+        size_t column;
+    };
+
+    /// Works out the line and column of offset, e.g. a csv_error or fastcsv_exception offset. Reads only keep byte
+    /// offsets so that nothing is counted per row, the line ends are counted here on demand
+    template <typename TElem, typename TTraits>
+    FASTCSV_NO_DISCARD csv_location locate(std::basic_string_view<TElem, TTraits> content, size_t offset)
+    {
+        offset = std::min(offset, content.size());
+        auto parser = detail::basic_csv_parser<TElem, TTraits>(content);
+
+        auto line = 0ul;
+        auto lineStart = content.data();
+        if (detail::count_line_ends<TElem, TTraits>(content.data(), content.data() + offset, line, lineStart))
+        {
+            parser.seek_line(static_cast<size_t>(lineStart - content.data()));
+        }
+        else
+        {
+            // quoted fields may span lines, walk the records instead
+            line = 0ul;
+            for (auto next = parser; next.advance_line() && next.line_start() <= offset; ++line)
+            {
+                parser = next;
+            }
+        }
+
+        return csv_location{ line, parser.column_of(offset) };
+    }
+
+    FASTCSV_NO_DISCARD inline csv_location locate(std::string_view content, size_t offset)
+    {
+        return locate<char, std::char_traits<char>>(content, offset);
+    }
+
+    enum class violation_kind
+    {
+        /// a row does not have one column per validated type, column holds the number of columns found
+        column_count,
+        /// a quoted field is not closed before the end of the content
+        unbalanced_quote,
+        /// a field does not convert to its column type
+        conversion
+    };
+
+    /// A problem found by validate_csv, the message is only formatted when asked for
+    struct csv_violation
+    {
+        violation_kind kind;
+        /// zero based line of the row within the content, the header is line zero when present
+        size_t row;
+        size_t column;
+        /// byte offset of the field, or of the row for column_count
+        size_t offset;
+        std::errc code;
+
+        FASTCSV_NO_DISCARD std::string message() const
+        {
+            switch (kind)
+            {
+            case violation_kind::column_count:
+                return fmt::format("Row {} at offset {} has {} columns", row, offset, column);
+            case violation_kind::unbalanced_quote:
+                return fmt::format("Unbalanced quote in column {} of row {} at offset {}", column, row, offset);
+            default:
+                return fmt::format(
+                    "Failed to convert column {} of row {} at offset {}, errorCode: {}",
+                    column,
+                    row,
+                    offset,
+                    std::make_error_code(code).message());
+            }
+        }
+    };
+
+    struct csv_validation
+    {
+        /// number of rows checked, not counting the header
+        size_t rows;
+        /// number of violations found, only the first few are kept in violations
+        size_t violation_count;
+        std::vector<csv_violation> violations;
+
+        FASTCSV_NO_DISCARD bool valid() const noexcept { return violation_count == 0ul; }
+    };
+
+    /// Column types recognised by infer_schema, ordered from the most to the least specific
+    enum class column_type
+    {
+        boolean,
+        integer,
+        floating_point,
+        date,
+        timestamp,
+        string
+    };
+
+    struct column_schema
+    {
+        /// name from the header, empty when the content has no header
+        std::string name;
+        column_type type;
+        /// true when a sampled field was empty
+        bool nullable;
+    };
+
+    struct csv_schema
+    {
+        std::vector<column_schema> columns;
+        /// number of rows the types were inferred from
+        size_t sampled_rows;
+    };
+
+    struct memo_stats
+    {
+        size_t hits;
+        size_t misses;
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR double hit_rate() const noexcept
+        {
+            return hits + misses == 0ul ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+        }
+    };
+
+    /// Direct mapped cache of converted values keyed on the raw field chars, for columns where the same text repeats
+    /// over long runs of rows. A hit skips from_csv entirely, a miss converts and replaces the slot
+    template <
+        typename T,
+        size_t Size = 64ul,
+        typename TElem = char,
+        typename TTraits = std::char_traits<TElem>>
+    class memo_cache
+    {
+        static_assert(Size != 0ul && (Size & (Size - 1ul)) == 0ul, "Size must be a power of two");
+
+    private:
+        struct entry
+        {
+            std::basic_string<TElem, TTraits> key;
+            std::optional<T> value;
+        };
+
+        std::vector<entry> entries_;
+        memo_stats stats_;
+
+    public:
+        memo_cache() : entries_(Size), stats_{ 0ul, 0ul } { }
+
+        /// Returns the value for the parser's current column and advances past it
+        FASTCSV_NO_DISCARD T convert(detail::basic_csv_parser<TElem, TTraits> & parser)
+        {
+            const auto raw = parser.current_column();
+            auto & slot = entries_[detail::hash_field(raw.data(), raw.data() + raw.size()) & (Size - 1ul)];
+
+            if (slot.value.has_value() && std::basic_string_view<TElem, TTraits>(slot.key) == raw)
+            {
+                ++stats_.hits;
+                parser.advance_column();
+                return *slot.value;
+            }
+
+            ++stats_.misses;
+            slot.value.reset();
+            auto value = from_csv<T, void, TElem, TTraits>{ parser }();
+
+            // a failure recorded instead of thrown leaves a placeholder that must not be cached
+            if (parser.has_error()) { return value; }
+
+            slot.key.assign(raw.data(), raw.size());
+            return slot.value.emplace(std::move(value));
+        }
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t hits() const noexcept { return stats_.hits; }
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR size_t misses() const noexcept { return stats_.misses; }
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR memo_stats stats() const noexcept { return stats_; }
+
+        void clear()
+        {
+            for (auto & slot : entries_)
+            {
+                slot.value.reset();
+            }
+            stats_ = memo_stats{ 0ul, 0ul };
+        }
+    };
+
+    /// Column marker for read_csv_v that converts the column through a memo_cache, the column is read as a
+    /// std::vector<T>
+    template <typename T, size_t Size = 64ul>
+    struct memoized
+    {
+    };
+
+    template <>
+    struct enum_mapping<bool>
+    {
+        static constexpr std::array<std::pair<std::string_view, bool>, 8> values{
+            { { "true"sv, true },
+              { "false"sv, false },
+              { "TRUE"sv, true },
+              { "True"sv, true },
+              { "t"sv, true },
+              { "FALSE"sv, false },
+              { "False"sv, false },
+              { "f"sv, false } }
+        };
+    };
+
+    template <typename TElem, typename TTraits = std::char_traits<TElem>>
+    struct basic_csv_reader
+    {
+        detail::basic_csv_parser<TElem, TTraits> & parser;
+
+        template <typename TRead, typename... TArgs>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR inline TRead read(TArgs &&... args) const
+        {
+            if constexpr (std::is_same_v<from_csv<TRead, void, TElem, TTraits>, decltype(*this)>)
+            {
+                throw fastcsv_exception(fmt::format("Recursive call  {} {}", __FILE__, __LINE__));
+            }
+
+            return from_csv<TRead, void, TElem, TTraits>{ parser }(std::forward<TArgs>()...);
+        }
+
+        template <typename TRead, typename... TArgs>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR inline std::optional<TRead> read_opt(TArgs &&... args) const
+        {
+            if constexpr (std::is_same_v<from_csv<std::optional<TRead>, void, TElem, TTraits>, decltype(*this)>)
+            {
+                throw fastcsv_exception(fmt::format("Recursive call  {} {}", __FILE__, __LINE__));
+            }
+
+            return from_csv<std::optional<TRead>, void, TElem, TTraits>{ parser }(std::forward<TArgs>(args)...);
+        }
+
+        template <typename TRead, size_t Size>
+        FASTCSV_NO_DISCARD inline TRead read_cached(memo_cache<TRead, Size, TElem, TTraits> & cache) const
+        {
+            return cache.convert(parser);
+        }
+    };
+
+    using csv_reader = basic_csv_reader<char>;
+
+
+    template <typename T, typename TElem, typename TTraits>
+    struct from_csv<T, std::enable_if_t<detail::has_from_chars_integral_v<T>>, TElem, TTraits> final
+      : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline T operator()([[maybe_unused]] const int base = 10) const
+        {
+            auto element = this->parser.consume_column();
+            auto result = T();
+            auto errorCode = try_parse(element, result, base);
+            if (errorCode != std::errc() && !this->parser.record_error(errorCode, element))
+            {
+                throw_parse_error(element, errorCode);
+            }
+            return result;
+        }
+
+        FASTCSV_NO_DISCARD inline static T parse(std::basic_string_view<TElem, TTraits> element, const int base = 10)
+        {
+            auto result = T();
+            auto errorCode = try_parse(element, result, base);
+            if (errorCode != std::errc()) { throw_parse_error(element, errorCode); }
+            return result;
+        }
+
+    private:
+        FASTCSV_NO_DISCARD inline static std::errc try_parse(
+            std::basic_string_view<TElem, TTraits> element, T & result, const int base)
+        {
+            auto errorCode = std::errc();
+
+            if (base == 10)
+            {
+                errorCode = detail::parse_decimal(element.data(), element.data() + element.size(), result);
+            }
+            else
+            {
+#if defined(FASTCSV_HAS_FROM_CHAR)
+                auto [ptr, ec] = std::from_chars(element.data(), element.data() + element.size(), result, base);
+                errorCode = ec;
+#else
+                // strtoll and strtoull skip leading spaces and wrap negative unsigned values, which from_chars rejects
+                const auto text = std::string(element);
+                if (text.empty() || std::isspace(static_cast<unsigned char>(text.front())) != 0
+                    || (std::is_unsigned_v<T> && text.front() == '-'))
+                {
+                    return std::errc::invalid_argument;
+                }
+
+                auto end = static_cast<char *>(nullptr);
+                errno = 0;
+                if constexpr (std::is_signed_v<T>)
+                {
+                    const auto value = std::strtoll(text.c_str(), &end, base);
+                    if (end == text.c_str()) { return std::errc::invalid_argument; }
+                    if (errno == ERANGE || value < std::numeric_limits<T>::min()
+                        || value > std::numeric_limits<T>::max())
+                    {
+                        return std::errc::result_out_of_range;
+                    }
+                    result = static_cast<T>(value);
+                }
+                else
+                {
+                    const auto value = std::strtoull(text.c_str(), &end, base);
+                    if (end == text.c_str()) { return std::errc::invalid_argument; }
+                    if (errno == ERANGE || value > std::numeric_limits<T>::max())
+                    {
+                        return std::errc::result_out_of_range;
+                    }
+                    result = static_cast<T>(value);
+                }
+#endif
+            }
+            return errorCode;
+        }
+
+        [[noreturn]] static void throw_parse_error(std::basic_string_view<TElem, TTraits> element, std::errc errorCode)
+        {
+            throw conversion_error(fmt::format(
+                "Failed to parse {} from '{}', errorCode: {}  {} {}",
+                typeid(T).name(),
+                element,
+                std::make_error_code(errorCode).message(),
+                __FILE__,
+                __LINE__));
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct from_csv<T, std::enable_if_t<std::is_floating_point_v<T>>, TElem, TTraits> final
+      : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline T operator()(const std::chars_format fmt = std::chars_format::general) const
+        {
+            auto element = this->parser.consume_column();
+            auto result = T();
+            auto errorCode = try_parse(element, result, fmt);
+            if (errorCode != std::errc() && !this->parser.record_error(errorCode, element))
+            {
+                throw_parse_error(element, errorCode);
+            }
+            return result;
+        }
+
+        FASTCSV_NO_DISCARD inline static T parse(
+            std::basic_string_view<TElem, TTraits> element, const std::chars_format fmt = std::chars_format::general)
+        {
+            auto result = T();
+            auto errorCode = try_parse(element, result, fmt);
+            if (errorCode != std::errc()) { throw_parse_error(element, errorCode); }
+            return result;
+        }
+
+    private:
+        // Not noexcept, long double and hex floats go through parse_floating_point_fallback which allocates
+        FASTCSV_NO_DISCARD inline static std::errc try_parse(
+            std::basic_string_view<TElem, TTraits> element, T & result, const std::chars_format fmt)
+        {
+            auto errorCode = std::errc();
+
+            if constexpr (detail::is_one_of_v<T, float, double>())
+            {
+                errorCode = detail::parse_floating_point(element.data(), element.data() + element.size(), result, fmt);
+            }
+            else
+            {
+                errorCode = detail::parse_floating_point_fallback(
+                    element.data(),
+                    element.data() + element.size(),
+                    result,
+                    fmt);
+            }
+            return errorCode;
+        }
+
+        [[noreturn]] static void throw_parse_error(std::basic_string_view<TElem, TTraits> element, std::errc errorCode)
+        {
+            throw conversion_error(fmt::format(
+                "Failed to parse {} from '{}', errorCode: {}  {} {}",
+                typeid(T).name(),
+                element,
+                std::make_error_code(errorCode).message(),
+                __FILE__,
+                __LINE__));
+        }
+    };
+
+    template <unsigned Scale, typename Rep, typename TElem, typename TTraits>
+    struct from_csv<decimal<Scale, Rep>, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline decimal<Scale, Rep> operator()() const
+        {
+            auto element = this->parser.consume_column();
+            auto result = Rep();
+            auto errorCode = detail::parse_fixed_point<Scale>(element.data(), element.data() + element.size(), result);
+            if (errorCode != std::errc() && !this->parser.record_error(errorCode, element))
+            {
+                throw_parse_error(element, errorCode);
+            }
+            return decimal<Scale, Rep>::from_raw(result);
+        }
+
+        FASTCSV_NO_DISCARD inline static decimal<Scale, Rep> parse(std::basic_string_view<TElem, TTraits> element)
+        {
+            auto result = Rep();
+            auto errorCode = detail::parse_fixed_point<Scale>(element.data(), element.data() + element.size(), result);
+            if (errorCode != std::errc()) { throw_parse_error(element, errorCode); }
+            return decimal<Scale, Rep>::from_raw(result);
+        }
+
+    private:
+        [[noreturn]] static void throw_parse_error(std::basic_string_view<TElem, TTraits> element, std::errc errorCode)
+        {
+            throw conversion_error(fmt::format(
+                "Failed to parse decimal<{}> from '{}', errorCode: {}  {} {}",
+                Scale,
+                element,
+                std::make_error_code(errorCode).message(),
+                __FILE__,
+                __LINE__));
+        }
+    };
+
+    template <typename TElem, typename TTraits>
+    struct from_csv<char, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline TElem operator()() const
+        {
+            auto value = this->parser.consume_column();
+            if (value.size() != 1ul)
+            {
+                if (this->parser.record_error(std::errc::invalid_argument, value)) { return TElem(); }
+
+                throw conversion_error(fmt::format(
+                    "Expected a single character, the field has {}  {} {}", value.size(), __FILE__, __LINE__));
+            }
+
+            return *value.data();
+        }
+    };
+
+    /// Unquotes and unescapes the raw csv field [first, last) within a mutable buffer without allocating and returns
+    /// a view over the rewritten value, which starts at first
+    template <typename TElem, typename TTraits = std::char_traits<TElem>>
+    FASTCSV_NO_DISCARD inline std::basic_string_view<TElem, TTraits> unescape_in_place(
+        TElem * first, TElem * last) noexcept
+    {
+        if (!detail::is_quoted(std::basic_string_view<TElem, TTraits>(first, static_cast<size_t>(last - first))))
+        {
+            return std::basic_string_view<TElem, TTraits>(first, static_cast<size_t>(last - first));
+        }
+
+        auto end = detail::unescape<TElem, TTraits>(first + 1, last - 1, first);
+        return std::basic_string_view<TElem, TTraits>(first, static_cast<size_t>(end - first));
+    }
+
+    /// Unquotes and unescapes a raw csv field held in a string, shrinking it to the unescaped value
+    template <typename TElem, typename TTraits, typename TAlloc>
+    inline void unescape_in_place(std::basic_string<TElem, TTraits, TAlloc> & value) noexcept
+    {
+        auto unescaped = unescape_in_place<TElem, TTraits>(value.data(), value.data() + value.size());
+        value.resize(unescaped.size());
+    }
+
+    template <typename TElem, typename TTraits>
+    struct from_csv<std::string, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline std::basic_string<TElem, TTraits> operator()() const
+        {
+            auto value = this->parser.consume_column();
+            if (!detail::is_quoted(value)) { return std::basic_string<TElem, TTraits>(value); }
+
+            auto first = value.data() + 1;
+            auto last = value.data() + value.size() - 1ul;
+
+            // Most quoted strings only protect delimiters, avoid the resize when there is nothing to unescape
+            if (detail::find_first<TElem, TTraits>(first, last, detail::escape<TElem>) == last)
+            {
+                return std::basic_string<TElem, TTraits>(first, last);
+            }
+
+            auto result = std::basic_string<TElem, TTraits>(static_cast<size_t>(last - first), TElem());
+            auto end = detail::unescape<TElem, TTraits>(first, last, result.data());
+            result.resize(static_cast<size_t>(end - result.data()));
+            return result;
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct from_csv<T, std::enable_if_t<has_enum_mapping<T>>, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline T operator()() const
+        {
+            auto element = this->parser.consume_column();
+            if (auto value = detail::enum_table<T>::find(element)) { return *value; }
+
+            if (!this->parser.record_error(std::errc::invalid_argument, element)) { throw_parse_error(element); }
+            return T();
+        }
+
+        FASTCSV_NO_DISCARD inline static T parse(std::basic_string_view<TElem, TTraits> element)
+        {
+            if (auto value = detail::enum_table<T>::find(element)) { return *value; }
+
+            throw_parse_error(element);
+        }
+
+    private:
+        [[noreturn]] static void throw_parse_error(std::basic_string_view<TElem, TTraits> element)
+        {
+            throw conversion_error(
+                fmt::format("Unable to parse {} from '{}'  {} {}", typeid(T).name(), element, __FILE__, __LINE__));
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct from_csv<std::optional<T>, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline std::optional<T> operator()() const
+        {
+            if (this->parser.current_column_empty())
+            {
+                this->parser.advance_column();
+                return std::nullopt;
+            }
+
+            return from_csv<T, void, TElem, TTraits>{ this->parser }();
+        }
+    };
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename TElem, typename TTraits>
+    struct from_csv<std::chrono::year_month_day, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline std::chrono::year_month_day operator()() const
+        {
+            auto element = this->parser.consume_column();
+
+            auto year = int64_t{ 0 };
+            auto month = 0u;
+            auto day = 0u;
+            if (element.size() != 10ul || detail::parse_iso8601_date(element.data(), year, month, day) != std::errc())
+            {
+                if (this->parser.record_error(std::errc::invalid_argument, element))
+                {
+                    return std::chrono::year_month_day();
+                }
+
+                throw conversion_error(
+                    fmt::format("Unable to parse year_month_day from '{}'  {} {}", element, __FILE__, __LINE__));
+            }
+
+            return std::chrono::year_month_day{ std::chrono::year(static_cast<int>(year)),
+                                                std::chrono::month(month),
+                                                std::chrono::day(day) };
+        }
+    };
+
+    template <typename Duration, typename TElem, typename TTraits>
+    struct from_csv<std::chrono::sys_time<Duration>, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline std::chrono::sys_time<Duration> operator()() const
+        {
+            auto element = this->parser.consume_column();
+            auto seconds = int64_t{ 0 };
+            auto nanoseconds = uint32_t{ 0 };
+            auto errorCode
+                = detail::parse_iso8601(element.data(), element.data() + element.size(), seconds, nanoseconds);
+            if (errorCode != std::errc())
+            {
+                if (!this->parser.record_error(errorCode, element)) { throw_parse_error(element); }
+                return std::chrono::sys_time<Duration>();
+            }
+            return from_parts(seconds, nanoseconds);
+        }
+
+        FASTCSV_NO_DISCARD inline static std::chrono::sys_time<Duration> parse(
+            std::basic_string_view<TElem, TTraits> element)
+        {
+            auto seconds = int64_t{ 0 };
+            auto nanoseconds = uint32_t{ 0 };
+            if (detail::parse_iso8601(element.data(), element.data() + element.size(), seconds, nanoseconds)
+                != std::errc())
+            {
+                throw_parse_error(element);
+            }
+            return from_parts(seconds, nanoseconds);
+        }
+
+    private:
+        FASTCSV_NO_DISCARD inline static std::chrono::sys_time<Duration> from_parts(
+            int64_t seconds, uint32_t nanoseconds) noexcept
+        {
+            // the fraction is below one second so flooring each part separately floors the sum
+            return std::chrono::sys_time<Duration>(
+                std::chrono::floor<Duration>(std::chrono::seconds(seconds))
+                + std::chrono::floor<Duration>(std::chrono::nanoseconds(nanoseconds)));
+        }
+
+        [[noreturn]] static void throw_parse_error(std::basic_string_view<TElem, TTraits> element)
+        {
+            throw conversion_error(
+                fmt::format("Unable to parse timestamp from '{}'  {} {}", element, __FILE__, __LINE__));
+        }
+    };
+#endif
+
+    template <typename... Ts>
+    struct from_csv<std::tuple<Ts...>, void, char> final : basic_csv_reader<char>
+    {
+        // braced initialisation reads the columns in order
+        FASTCSV_NO_DISCARD inline std::tuple<Ts...> operator()() const { return std::tuple<Ts...>{ read<Ts>()... }; }
+    };
+
+    template <typename T, size_t N, typename TElem, typename TTraits>
+    struct from_csv<std::array<T, N>, void, TElem, TTraits> final : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline std::array<T, N> operator()() const
+        {
+            auto result = std::array<T, N>{};
+            for (auto i = 0ul; i < N; ++i)
+            {
+                result[i] = this->template read<T>();
+            }
+            return result;
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct from_csv<T, std::enable_if_t<detail::is_readable_aggregate_v<T>>, TElem, TTraits> final
+      : basic_csv_reader<TElem, TTraits>
+    {
+        FASTCSV_NO_DISCARD inline T operator()() const
+        {
+            return read_members(std::make_index_sequence<std::tuple_size_v<members>>());
+        }
+
+    private:
+        using members = detail::aggregate_members_t<T>;
+
+        // One braced initialisation converts the members in order, so the whole row is a flat sequence of inlined
+        // column conversions constructed in place
+        template <size_t... Is>
+        FASTCSV_NO_DISCARD inline T read_members(std::index_sequence<Is...>) const
+        {
+            return T{ from_csv<std::tuple_element_t<Is, members>, void, TElem, TTraits>{ this->parser }()... };
+        }
+    };
+
+    template <typename T>
+    struct csv_never_needs_quoting<
+        T,
+        std::enable_if_t<
+            (detail::has_from_chars_integral_v<T> && !std::is_same_v<T, char>) || std::is_floating_point_v<T>>>
+      : std::true_type
+    {
+    };
+
+    template <unsigned Scale, typename Rep>
+    struct csv_never_needs_quoting<decimal<Scale, Rep>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct csv_never_needs_quoting<T, std::enable_if_t<has_enum_mapping<T>>>
+      : std::bool_constant<detail::enum_table<T>::names_are_plain>
+    {
+    };
+
+    template <typename T>
+    struct csv_never_needs_quoting<std::optional<T>> : csv_never_needs_quoting<T>
+    {
+    };
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <>
+    struct csv_never_needs_quoting<std::chrono::year_month_day> : std::true_type
+    {
+    };
+
+    template <typename Duration>
+    struct csv_never_needs_quoting<std::chrono::sys_time<Duration>> : std::true_type
+    {
+    };
+#endif
+
+    namespace detail
+    {
+
+        // Most elements to_csv<T> formats in place, zero when it has no in place format
+        template <typename T, typename TElem, typename TTraits, typename = void>
+        inline constexpr size_t inplace_max_chars_v = 0ul;
+
+        template <typename T, typename TElem, typename TTraits>
+        inline constexpr size_t
+            inplace_max_chars_v<T, TElem, TTraits, std::void_t<decltype(to_csv<T, void, TElem, TTraits>::max_chars)>>
+            = to_csv<T, void, TElem, TTraits>::max_chars;
+
+        template <typename TElem, typename TTraits, typename... Ts>
+        inline constexpr bool is_plain_row_v
+            = sizeof...(Ts) != 0ul
+              && ((csv_never_needs_quoting_v<Ts> && inplace_max_chars_v<Ts, TElem, TTraits> != 0ul) && ...);
+
+    }  // namespace detail
+
+    /// Growable contiguous buffer the writers append to. With a stream attached it is flushed to the stream in blocks
+    /// of block_size elements, so streambuf calls, sentries and locale checks are paid per block rather than per cell
+    template <typename TElem, typename TTraits = std::char_traits<TElem>>
+    class basic_output_buffer
+    {
+    public:
+        using value_type = TElem;
+
+        static constexpr size_t block_size = 65536ul;
+
+        /// Keeps everything in memory, read it back with view()
+        basic_output_buffer() : stream_(nullptr), data_(), size_(0ul), capacity_(0ul) {}
+
+        explicit basic_output_buffer(std::basic_ostream<TElem, TTraits> & stream)
+          : stream_(&stream), data_(std::make_unique<TElem[]>(block_size)), size_(0ul), capacity_(block_size)
+        {
+        }
+
+        basic_output_buffer(const basic_output_buffer &) = delete;
+        basic_output_buffer & operator=(const basic_output_buffer &) = delete;
+
+        ~basic_output_buffer()
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+        }
+
+        inline void push_back(TElem value)
+        {
+            if (size_ == capacity_) { make_room(1ul); }
+            data_[size_++] = value;
+        }
+
+        inline void append(const TElem * first, const TElem * last)
+        {
+            const auto count = static_cast<size_t>(last - first);
+            if (count > capacity_ - size_) { make_room(count); }
+            TTraits::copy(data_.get() + size_, first, count);
+            size_ += count;
+        }
+
+        inline void append(std::basic_string_view<TElem, TTraits> value)
+        {
+            append(value.data(), value.data() + value.size());
+        }
+
+        /// Space for at least count elements to be written in place, finish with commit
+        FASTCSV_NO_DISCARD inline TElem * reserve(size_t count)
+        {
+            if (count > capacity_ - size_) { make_room(count); }
+            return data_.get() + size_;
+        }
+
+        inline void commit(const TElem * end) noexcept { size_ = static_cast<size_t>(end - data_.get()); }
+
+        FASTCSV_NO_DISCARD std::basic_string_view<TElem, TTraits> view() const noexcept
+        {
+            return std::basic_string_view<TElem, TTraits>(data_.get(), size_);
+        }
+
+        FASTCSV_NO_DISCARD size_t size() const noexcept { return size_; }
+
+        /// Drops the buffered elements without writing them, keeping the capacity
+        void clear() noexcept { size_ = 0ul; }
+
+        /// Writes the buffered elements to the stream, does nothing without one
+        void flush()
+        {
+            if (stream_ == nullptr || size_ == 0ul) { return; }
+
+            stream_->write(data_.get(), static_cast<std::streamsize>(size_));
+            size_ = 0ul;
+        }
+
+    private:
+        void make_room(size_t count)
+        {
+            flush();
+            if (count <= capacity_ - size_) { return; }
+
+            const auto capacity = std::max({ capacity_ * 2ul, size_ + count, size_t{ 256ul } });
+            auto data = std::make_unique<TElem[]>(capacity);
+            if (size_ != 0ul) { TTraits::copy(data.get(), data_.get(), size_); }
+            data_ = std::move(data);
+            capacity_ = capacity;
+        }
+
+        std::basic_ostream<TElem, TTraits> * stream_;
+        std::unique_ptr<TElem[]> data_;
+        size_t size_;
+        size_t capacity_;
+    };
+
+    using output_buffer = basic_output_buffer<char>;
+
+    template <typename TElem, typename TTraits = std::char_traits<TElem>>
+    struct basic_csv_writer
+    {
+        basic_output_buffer<TElem, TTraits> & out;
+        bool first;
+
+        template <typename TWrite, typename... TArgs>
+        inline void write(const TWrite & value, TArgs &&... args)
+        {
+            if constexpr (std::is_same_v<to_csv<TWrite, void, TElem, TTraits>, decltype(*this)>)
+            {
+                throw fastcsv_exception(fmt::format("Recursive call  {} {}", __FILE__, __LINE__));
+            }
+
+            if (!first) { out.push_back(detail::default_column_delimiter<TElem>); }
+
+            to_csv<TWrite, void, TElem, TTraits>{ out, true }(value, std::forward<TArgs>(args)...);
+
+            first = false;
+        }
+
+        /// Writes each value as the next field. When every field never needs quoting and formats in place the row is
+        /// a single reservation followed by the formatters and delimiter stores, with no checks per field
+        template <typename... TWrite>
+        inline void write_row(const TWrite &... values)
+        {
+            if constexpr (detail::is_plain_row_v<TElem, TTraits, TWrite...>)
+            {
+                constexpr auto size = ((detail::inplace_max_chars_v<TWrite, TElem, TTraits> + 1ul) + ...);
+
+                auto dest = out.reserve(size + 1ul);
+                if (!first) { *dest++ = detail::default_column_delimiter<TElem>; }
+                ((dest = to_csv<TWrite, void, TElem, TTraits>::format(values, dest),
+                  *dest++ = detail::default_column_delimiter<TElem>),
+                 ...);
+                out.commit(dest - 1);
+
+                first = false;
+            }
+            else
+            {
+                (write(values), ...);
+            }
+        }
+    };
+
+    using csv_writer = basic_csv_writer<char>;
+
+    template <typename T, typename TElem, typename TTraits>
+    struct to_csv<T, std::enable_if_t<detail::has_from_chars_integral_v<T>>, TElem, TTraits> final
+      : basic_csv_writer<TElem, TTraits>
+    {
+        static constexpr size_t max_chars = 21ul;
+
+        FASTCSV_NO_DISCARD inline static TElem * format(T value, TElem * dest) noexcept
+        {
+            return detail::format_integer(value, dest);
+        }
+
+        inline void operator()(T value) { this->out.commit(format(value, this->out.reserve(max_chars))); }
+        /// Writes the value through an fmt format string such as "{:08}", for layouts the in place formatter lacks
+        inline void operator()(T value, std::basic_string_view<TElem, TTraits> fmt)
+        {
+            fmt::format_to(std::back_inserter(this->out), fmt::runtime(fmt), value);
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct to_csv<T, std::enable_if_t<std::is_floating_point_v<T>>, TElem, TTraits> final
+      : basic_csv_writer<TElem, TTraits>
+    {
+        // shortest round trip representation of any floating point type, with room to spare
+        static constexpr size_t max_chars = 64ul;
+
+        /// Writes the shortest representation that reads back to the same value
+        FASTCSV_NO_DISCARD inline static TElem * format(T value, TElem * dest)
+        {
+            return format_chars(dest, max_chars, [value](char * first, char * last) {
+#if defined(FASTCSV_HAS_FLOAT_TO_CHARS)
+                return std::to_chars(first, last, value).ptr;
+#else
+                return fmt::format_to_n(first, static_cast<size_t>(last - first), "{}", value).out;
+#endif
+            });
+        }
+
+        inline void operator()(T value) { this->out.commit(format(value, this->out.reserve(max_chars))); }
+
+        /// Writes exactly precision fractional digits
+        inline void operator()(T value, int precision)
+        {
+            // every integer digit of the largest value, sign, point and the fraction
+            const auto size = static_cast<size_t>(std::numeric_limits<T>::max_exponent10 + 3 + std::max(precision, 0));
+            this->out.commit(format_chars(this->out.reserve(size), size, [value, precision](char * first, char * last) {
+#if defined(FASTCSV_HAS_FLOAT_TO_CHARS)
+                return std::to_chars(first, last, value, std::chars_format::fixed, precision).ptr;
+#else
+                return fmt::format_to_n(first, static_cast<size_t>(last - first), "{:.{}f}", value, precision).out;
+#endif
+            }));
+        }
+
+        /// Writes the value through an fmt format string such as "{:08}", for layouts the in place formatter lacks
+        inline void operator()(T value, std::basic_string_view<TElem, TTraits> fmt)
+        {
+            fmt::format_to(std::back_inserter(this->out), fmt::runtime(fmt), value);
+        }
+
+    private:
+        // Formats at dest when writing chars, other element types go through a char buffer first
+        template <typename TFormat>
+        FASTCSV_NO_DISCARD inline static TElem * format_chars(TElem * dest, size_t size, TFormat format)
+        {
+            if constexpr (std::is_same_v<TElem, char>) { return format(dest, dest + size); }
+            else
+            {
+                auto buffer = std::string(size, '\0');
+                auto last = format(buffer.data(), buffer.data() + size);
+                return std::transform(buffer.data(), last, dest, [](char c) { return static_cast<TElem>(c); });
+            }
+        }
+    };
+
+    template <unsigned Scale, typename Rep, typename TElem, typename TTraits>
+    struct to_csv<decimal<Scale, Rep>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        static constexpr size_t max_chars = 24ul;
+
+        FASTCSV_NO_DISCARD inline static TElem * format(decimal<Scale, Rep> value, TElem * dest) noexcept
+        {
+            return detail::format_fixed_point<Scale>(value.raw(), dest);
+        }
+
+        inline void operator()(decimal<Scale, Rep> value)
+        {
+            this->out.commit(format(value, this->out.reserve(max_chars)));
+        }
+    };
+
+    template <typename TElem, typename TTraits>
+    struct to_csv<char, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        inline void operator()(char value) { this->out.push_back(value); }
+    };
+
+    template <typename TElem, typename TTraits>
+    struct to_csv<std::basic_string<TElem, TTraits>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        inline void operator()(const std::basic_string<TElem, TTraits> & value)
+        {
+            auto first = value.data();
+            const auto last = value.data() + value.size();
+
+            const auto kind = detail::classify_quoting<TElem, TTraits>(first, last);
+            if (kind == detail::quoting::none)
+            {
+                this->out.append(first, last);
+                return;
+            }
+
+            this->out.push_back(detail::quote<TElem>);
+            if (kind == detail::quoting::escape)
+            {
+                // copy the runs between quotes in bulk
+                for (auto quotePos = detail::find_first<TElem, TTraits>(first, last, detail::quote<TElem>);
+                     quotePos != last;
+                     quotePos = detail::find_first<TElem, TTraits>(first, last, detail::quote<TElem>))
+                {
+                    this->out.append(first, quotePos);
+                    this->out.push_back(detail::escape<TElem>);
+                    this->out.push_back(detail::quote<TElem>);
+                    first = quotePos + 1;
+                }
+            }
+            this->out.append(first, last);
+            this->out.push_back(detail::quote<TElem>);
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct to_csv<T, std::enable_if_t<has_enum_mapping<T>>, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        static constexpr size_t max_chars = detail::enum_table<T>::max_name_size;
+
+        FASTCSV_NO_DISCARD inline static TElem * format(T value, TElem * dest)
+        {
+            const auto name = checked_name(value);
+            return std::transform(name.begin(), name.end(), dest, [](char c) { return static_cast<TElem>(c); });
+        }
+
+        inline void operator()(T value)
+        {
+            if constexpr (detail::enum_table<T>::names_are_plain)
+            {
+                this->out.commit(format(value, this->out.reserve(max_chars)));
+            }
+            else
+            {
+                const auto name = checked_name(value);
+                to_csv<std::basic_string<TElem, TTraits>, void, TElem, TTraits>{ this->out, this->first }(
+                    std::basic_string<TElem, TTraits>(name.begin(), name.end()));
+            }
+        }
+
+    private:
+        FASTCSV_NO_DISCARD static std::string_view checked_name(T value)
+        {
+            auto name = detail::enum_table<T>::name(value);
+            if (name.empty())
+            {
+                throw fastcsv_exception(fmt::format(
+                    "No enum_mapping name for {} value {}  {} {}",
+                    typeid(T).name(),
+                    detail::to_underlying(value),
+                    __FILE__,
+                    __LINE__));
+            }
+            return name;
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct to_csv<std::optional<T>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        static constexpr size_t max_chars = detail::inplace_max_chars_v<T, TElem, TTraits>;
+
+        template <typename U = T>
+        FASTCSV_NO_DISCARD inline static TElem * format(const std::optional<U> & value, TElem * dest)
+        {
+            return value ? to_csv<U, void, TElem, TTraits>::format(*value, dest) : dest;
+        }
+
+        inline void operator()(const std::optional<T> & value)
+        {
+            if (!value) { return; }
+
+            to_csv<T, void, TElem, TTraits>{ this->out, this->first }(*value);
+        }
+    };
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename TElem, typename TTraits>
+    struct to_csv<std::chrono::year_month_day, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        static constexpr size_t max_chars = 32ul;
+
+        FASTCSV_NO_DISCARD inline static TElem * format(std::chrono::year_month_day value, TElem * dest) noexcept
+        {
+            return detail::format_iso8601_date(
+                value.year().operator int(),
+                value.month().operator unsigned int(),
+                value.day().operator unsigned int(),
+                dest);
+        }
+
+        inline void operator()(std::chrono::year_month_day value)
+        {
+            this->out.commit(format(value, this->out.reserve(max_chars)));
+        }
+    };
+
+    template <typename Duration, typename TElem, typename TTraits>
+    struct to_csv<std::chrono::sys_time<Duration>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        using period = typename Duration::period;
+
+        // fractional digits written for the duration's precision, coarser than seconds writes none
+        static constexpr unsigned fraction_digits = []() {
+            if constexpr (std::ratio_greater_equal_v<period, std::ratio<1>>) { return 0u; }
+            else
+            {
+                for (auto digits = 1u; digits <= 9u; ++digits)
+                {
+                    if (period::num == 1 && static_cast<uint64_t>(period::den) == detail::power_of_ten(digits))
+                    {
+                        return digits;
+                    }
+                }
+                return 9u;
+            }
+        }();
+
+        static constexpr size_t max_chars = 48ul;
+
+        FASTCSV_NO_DISCARD inline static TElem * format(std::chrono::sys_time<Duration> value, TElem * buffer) noexcept
+        {
+            TElem * end;
+
+            if constexpr (std::ratio_greater_equal_v<period, std::chrono::days::period>)
+            {
+                auto date = std::chrono::year_month_day(std::chrono::floor<std::chrono::days>(value));
+                end = detail::format_iso8601_date(
+                    date.year().operator int(),
+                    date.month().operator unsigned int(),
+                    date.day().operator unsigned int(),
+                    buffer);
+            }
+            else
+            {
+                auto seconds = std::chrono::floor<std::chrono::seconds>(value);
+                end = detail::format_iso8601(seconds.time_since_epoch().count(), buffer);
+
+                if constexpr (fraction_digits != 0u)
+                {
+                    auto fraction = value - seconds;
+                    auto count = static_cast<uint64_t>(
+                        fraction_digits == 9u && !(period::num == 1 && period::den == 1000000000)
+                            ? std::chrono::duration_cast<std::chrono::nanoseconds>(fraction).count()
+                            : fraction.count());
+
+                    *end++ = static_cast<TElem>('.');
+                    end = detail::format_digits(count, fraction_digits, end);
+                }
+            }
+
+            return end;
+        }
+
+        inline void operator()(std::chrono::sys_time<Duration> value)
+        {
+            this->out.commit(format(value, this->out.reserve(max_chars)));
+        }
+    };
+#endif
+
+    template <typename... Ts>
+    struct to_csv<std::tuple<Ts...>, void> final : csv_writer
+    {
+        inline void operator()(const std::tuple<Ts...> & value)
+        {
+            std::apply([this](const auto &... fields) { write_row(fields...); }, value);
+        }
+    };
+
+    template <typename T, size_t N, typename TElem, typename TTraits>
+    struct to_csv<std::array<T, N>, void, TElem, TTraits> final : basic_csv_writer<TElem, TTraits>
+    {
+        inline void operator()(const std::array<T, N> & value)
+        {
+            std::apply([this](const auto &... fields) { this->write_row(fields...); }, value);
+        }
+    };
+
+    template <typename T, typename TElem, typename TTraits>
+    struct to_csv<T, std::enable_if_t<detail::is_writable_aggregate_v<T>>, TElem, TTraits> final
+      : basic_csv_writer<TElem, TTraits>
+    {
+        inline void operator()(const T & value)
+        {
+            std::apply([this](const auto &... members) { this->write_row(members...); }, detail::tie_members(value));
+        }
+    };
+
+    namespace detail
+    {
+
+        struct no_memo_cache
+        {
+        };
+
+        template <typename T>
+        struct column_traits
+        {
+            using value_type = T;
+            using cache_type = no_memo_cache;
+        };
+
+        template <typename T, size_t Size>
+        struct column_traits<memoized<T, Size>>
+        {
+            using value_type = T;
+            using cache_type = memo_cache<T, Size>;
+        };
+
+        template <typename T>
+        using column_value_t = typename column_traits<T>::value_type;
+
+        template <typename T>
+        using column_cache_t = typename column_traits<T>::cache_type;
+
+        template <typename T>
+        FASTCSV_NO_DISCARD inline T read_column(csv_parser & parser, no_memo_cache &)
+        {
+            return from_csv<T>{ parser }();
+        }
+
+        template <typename T, size_t Size>
+        FASTCSV_NO_DISCARD inline T read_column(csv_parser & parser, memo_cache<T, Size> & cache)
+        {
+            return cache.convert(parser);
+        }
+
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR memo_stats column_stats(const no_memo_cache &) noexcept
+        {
+            return memo_stats{ 0ul, 0ul };
+        }
+
+        template <typename T, size_t Size>
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR memo_stats column_stats(const memo_cache<T, Size> & cache) noexcept
+        {
+            return cache.stats();
+        }
+
+        template <size_t I = 0ul, typename... Ts, typename... TCaches>
+        void read_line(csv_parser & parser, std::tuple<std::vector<Ts>...> & vectors, std::tuple<TCaches...> & caches)
+        {
+            if constexpr (I == sizeof...(Ts)) { return; }
+            else
+            {
+                auto & vec = std::get<I>(vectors);
+                using value_type = typename std::remove_reference_t<decltype(vec)>::value_type;
+                vec.emplace_back(read_column<value_type>(parser, std::get<I>(caches)));
+
+                read_line<I + 1ul>(parser, vectors, caches);
+            }
+        }
+
+        inline constexpr size_t column_block_rows = 4096ul;
+
+        // Formats rows [first, last) of one column back to back into cells, ends[i] is one past the i-th cell
+        template <typename T>
+        void format_column(
+            output_buffer & cells, std::vector<size_t> & ends, const std::vector<T> & vector, size_t first, size_t last)
+        {
+            cells.clear();
+            ends.clear();
+
+            if constexpr (csv_never_needs_quoting_v<T> && inplace_max_chars_v<T, char, std::char_traits<char>> != 0ul)
+            {
+                const auto begin = cells.reserve((last - first) * inplace_max_chars_v<T, char, std::char_traits<char>>);
+                auto dest = begin;
+                for (auto i = first; i < last; ++i)
+                {
+                    dest = to_csv<T>::format(vector[i], dest);
+                    ends.push_back(static_cast<size_t>(dest - begin));
+                }
+                cells.commit(dest);
+            }
+            else
+            {
+                auto writer = to_csv<T>{ cells, true };
+                for (auto i = first; i < last; ++i)
+                {
+                    writer.first = true;
+                    writer(vector[i]);
+                    ends.push_back(cells.size());
+                }
+            }
+        }
+
+        struct no_header_tag
+        {
+        };
+
+        struct parallel_tag
+        {
+        };
+
+        struct uncached_tag
+        {
+        };
+
+        // Records the exception being handled against the field that failed, the std::invalid_argument and
+        // std::out_of_range of std::sto based conversions included. Anything else, other fastcsv_exceptions such as
+        // failed file reads included, is not a conversion failure and is rethrown
+        inline void record_thrown_error(csv_parser & parser)
+        {
+            try
+            {
+                throw;
+            }
+            catch (const conversion_error &)
+            {
+                parser.record_error(std::errc::invalid_argument, parser.failed_field());
+            }
+            catch (const std::invalid_argument &)
+            {
+                parser.record_error(std::errc::invalid_argument, parser.failed_field());
+            }
+            catch (const std::out_of_range &)
+            {
+                parser.record_error(std::errc::result_out_of_range, parser.failed_field());
+            }
+        }
+
+        // Converts one row while the parser records errors, failures thrown by user conversions are recorded too
+        template <typename T>
+        FASTCSV_NO_DISCARD std::optional<T> convert_row(csv_parser & parser)
+        {
+            try
+            {
+                return from_csv<T>{ parser }();
+            }
+            catch (...)
+            {
+                record_thrown_error(parser);
+                return std::nullopt;
+            }
+        }
+
+        // Rethrows a conversion failure with the location of the failing field, which is only worked out now. When
+        // content is a piece of a larger input starting at firstLine and firstOffset the location is within the input.
+        // Like csv_location, firstLine counts records rather than line ends, so it is the number of rows before content
+        [[noreturn]] inline void throw_located(
+            std::string_view content,
+            const csv_parser & parser,
+            const fastcsv_exception & exception,
+            size_t firstLine = 0ul,
+            size_t firstOffset = 0ul)
+        {
+            auto offset = parser.error_offset();
+            if (!parser.has_error())
+            {
+                const auto field = parser.failed_field();
+                offset = field.data() == nullptr ? content.size() : static_cast<size_t>(field.data() - content.data());
+            }
+            const auto location = locate(content, offset);
+            auto message
+                = fmt::format("{}  line {} column {}", exception.what(), firstLine + location.line, location.column);
+            if (dynamic_cast<const conversion_error *>(&exception) != nullptr)
+            {
+                throw conversion_error(std::move(message), firstOffset + offset);
+            }
+            throw fastcsv_exception(std::move(message), firstOffset + offset);
+        }
+
+        // True when a field running to the end of the content leaves a quoted string open
+        FASTCSV_NO_DISCARD inline bool ends_inside_quote(std::string_view element) noexcept
+        {
+            auto inside = false;
+            for (auto i = 0ul; i < element.size(); ++i)
+            {
+                if (element[i] == quote<char>) { inside = !inside; }
+                else if (
+                    inside && element[i] == escape<char> && i + 1ul < element.size() && element[i + 1ul] == quote<char>)
+                {
+                    ++i;
+                }
+            }
+            return inside;
+        }
+
+        // Checks that a field converts to T without keeping the result, the common types call their parsing kernels
+        // directly and strings are always valid
+        template <typename T>
+        FASTCSV_NO_DISCARD std::errc validate_field(std::string_view element)
+        {
+            if constexpr (std::is_same_v<T, std::string>) { return std::errc(); }
+            else if constexpr (has_from_chars_integral_v<T> && !std::is_same_v<T, char>)
+            {
+                auto result = T();
+                return parse_decimal(element.data(), element.data() + element.size(), result);
+            }
+            else if constexpr (is_one_of_v<T, float, double>())
+            {
+                auto result = T();
+                return parse_floating_point(
+                    element.data(),
+                    element.data() + element.size(),
+                    result,
+                    std::chars_format::general);
+            }
+            else
+            {
+                auto parser = csv_parser(element);
+                parser.record_errors(true);
+                try
+                {
+                    (void)from_csv<T>{ parser }();
+                }
+                catch (...)
+                {
+                    record_thrown_error(parser);
+                }
+                return parser.error();
+            }
+        }
+
+        using field_validator = std::errc (*)(std::string_view);
+
+        struct validation_chunk
+        {
+            size_t begin;
+            size_t limit;
+            size_t end;
+            size_t rows;
+            size_t violationCount;
+            std::vector<csv_violation> violations;
+        };
+
+        // Validates the rows that start in [begin, limit), begin must be the start of a row. Rows are numbered from
+        // the start of the chunk and renumbered when the chunks are merged
+        template <size_t N>
+        FASTCSV_NO_DISCARD validation_chunk validate_rows(
+            std::string_view content,
+            size_t begin,
+            size_t limit,
+            const std::array<field_validator, N> & validators,
+            size_t maxViolations)
+        {
+            auto chunk = validation_chunk{ begin, limit, begin, 0ul, 0ul, {} };
+            auto report = [&](violation_kind kind, size_t column, size_t offset, std::errc code) {
+                if (chunk.violations.size() < maxViolations)
+                {
+                    chunk.violations.push_back(csv_violation{ kind, chunk.rows, column, offset, code });
+                }
+                ++chunk.violationCount;
+            };
+
+            auto parser = csv_parser(content);
+            parser.seek_line(begin);
+
+            while (!parser.end_of_file() && parser.line_start() < limit)
+            {
+                auto column = 0ul;
+                do
+                {
+                    const auto element = parser.current_column();
+                    const auto offset = element.data() == nullptr
+                                            ? content.size()
+                                            : static_cast<size_t>(element.data() - content.data());
+
+                    if (offset + element.size() == content.size() && ends_inside_quote(element))
+                    {
+                        report(violation_kind::unbalanced_quote, column, offset, std::errc::invalid_argument);
+                    }
+                    else if (column < N)
+                    {
+                        if (auto code = validators[column](element); code != std::errc())
+                        {
+                            report(violation_kind::conversion, column, offset, code);
+                        }
+                    }
+                    ++column;
+                } while (parser.advance_column());
+
+                if (column != N)
+                {
+                    report(violation_kind::column_count, column, parser.line_start(), std::errc::invalid_argument);
+                }
+
+                ++chunk.rows;
+                parser.advance_line();
+            }
+
+            chunk.end = parser.line_start();
+            return chunk;
+        }
+
+        // Validates [begin, size) split into chunkCount chunks at line ends. A split inside a quoted field is noticed
+        // when the previous chunk runs past it, the chunk is then validated again from where the previous one stopped
+        template <size_t N>
+        FASTCSV_NO_DISCARD csv_validation validate_chunks(
+            std::string_view content,
+            size_t begin,
+            size_t firstRow,
+            const std::array<field_validator, N> & validators,
+            size_t maxViolations,
+            size_t chunkCount)
+        {
+            auto limits = std::vector<size_t>();
+            for (auto i = 1ul; i < chunkCount; ++i)
+            {
+                const auto target = begin + (content.size() - begin) * i / chunkCount;
+                const auto lineEnd = find_first<char>(content.data() + target, content.data() + content.size(), '\n');
+                const auto limit = std::min(static_cast<size_t>(lineEnd - content.data()) + 1ul, content.size());
+                limits.push_back(std::max(limit, limits.empty() ? begin : limits.back()));
+            }
+            limits.push_back(content.size());
+
+            auto pending = std::vector<std::future<validation_chunk>>();
+            for (auto i = 1ul; i < limits.size(); ++i)
+            {
+                pending.push_back(std::async(std::launch::async, [&, i]() {
+                    return validate_rows(content, limits[i - 1ul], limits[i], validators, maxViolations);
+                }));
+            }
+
+            auto chunks = std::vector<validation_chunk>();
+            chunks.push_back(validate_rows(content, begin, limits[0], validators, maxViolations));
+            for (auto & future : pending)
+            {
+                chunks.push_back(future.get());
+            }
+
+            auto result = csv_validation{ 0ul, 0ul, {} };
+            auto position = begin;
+            for (auto & chunk : chunks)
+            {
+                if (chunk.begin != position)
+                {
+                    chunk = validate_rows(content, position, chunk.limit, validators, maxViolations);
+                }
+
+                for (auto & violation : chunk.violations)
+                {
+                    if (result.violations.size() == maxViolations) { break; }
+                    violation.row += firstRow + result.rows;
+                    result.violations.push_back(violation);
+                }
+
+                result.rows += chunk.rows;
+                result.violation_count += chunk.violationCount;
+                position = chunk.end;
+            }
+
+            return result;
+        }
+
+        // Bit per column_type, a field keeps the bits of every type it can be read as
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR uint32_t column_type_bit(column_type type) noexcept
+        {
+            return 1u << static_cast<uint32_t>(type);
+        }
+
+        // Empty fields and empty quoted strings are null in any column
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR bool is_null_field(std::string_view element) noexcept
+        {
+            return element.empty() || (element.size() == 2ul && element[0] == quote<char> && element[1] == quote<char>);
+        }
+
+        // Classifies a non null field with a scan of its character classes, the parsing kernels only confirm the
+        // shapes that look like a number, date or timestamp. Words such as nan and inf stay strings
+        FASTCSV_NO_DISCARD inline uint32_t classify_field(std::string_view element) noexcept
+        {
+            constexpr auto stringBit = column_type_bit(column_type::string);
+            constexpr auto floatBits = stringBit | column_type_bit(column_type::floating_point);
+            constexpr auto integerBits = floatBits | column_type_bit(column_type::integer);
+            constexpr auto timestampBits = stringBit | column_type_bit(column_type::timestamp);
+            constexpr auto dateBits = timestampBits | column_type_bit(column_type::date);
+            constexpr auto booleanBits = stringBit | column_type_bit(column_type::boolean);
+
+            if (element.front() == quote<char>) { return stringBit; }
+
+            const auto first = element.data();
+            const auto last = element.data() + element.size();
+
+            if (element.size() >= 10ul && matches_layout(first, "dddd-dd-dd"sv))
+            {
+                auto seconds = int64_t{ 0 };
+                auto nanoseconds = uint32_t{ 0 };
+                if (parse_iso8601(first, last, seconds, nanoseconds) != std::errc()) { return stringBit; }
+                return element.size() == 10ul ? dateBits : timestampBits;
+            }
+
+            auto digits = 0ul;
+            auto numberChars = 0ul;
+            for (auto c : element)
+            {
+                digits += static_cast<size_t>(is_digit(c));
+                numberChars += static_cast<size_t>(c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-');
+            }
+
+            if (digits + numberChars == element.size())
+            {
+                if (digits == element.size() - static_cast<size_t>(element.front() == '-'))
+                {
+                    auto integer = int64_t{ 0 };
+                    if (parse_decimal(first, last, integer) == std::errc()) { return integerBits; }
+                }
+
+                auto value = 0.0;
+                return parse_floating_point(first, last, value, std::chars_format::general) == std::errc() ? floatBits
+                                                                                                         : stringBit;
+            }
+
+            if (element.size() <= 5ul && enum_table<bool>::find(element) != nullptr) { return booleanBits; }
+
+            return stringBit;
+        }
+
+        // Applies the policy to the row that failed, returns false when reading should stop
+        inline bool record_row_error(
+            csv_parser & parser,
+            error_policy policy,
+            size_t row,
+            std::vector<csv_error> & errors,
+            size_t firstOffset = 0ul)
+        {
+            if (policy != error_policy::skip)
+            {
+                errors.push_back(
+                    csv_error{ row, parser.error_column(), firstOffset + parser.error_offset(), parser.error() });
+            }
+            parser.clear_error();
+            return policy != error_policy::abort;
+        }
+
+#if defined(FASTCSV_HAS_CXX20)
+        using table_date = std::chrono::year_month_day;
+        using table_timestamp = std::chrono::sys_time<std::chrono::nanoseconds>;
+
+        using table_column = std::variant<
+            std::vector<bool>,
+            std::vector<int64_t>,
+            std::vector<double>,
+            std::vector<table_date>,
+            std::vector<table_timestamp>,
+            std::vector<std::string>>;
+#else
+        // Without <chrono> calendar types dates and timestamps are kept as their text
+        using table_column
+            = std::variant<std::vector<bool>, std::vector<int64_t>, std::vector<double>, std::vector<std::string>>;
+#endif
+
+        FASTCSV_NO_DISCARD inline table_column make_table_column(column_type type)
+        {
+            switch (type)
+            {
+            case column_type::boolean: return std::vector<bool>();
+            case column_type::integer: return std::vector<int64_t>();
+            case column_type::floating_point: return std::vector<double>();
+#if defined(FASTCSV_HAS_CXX20)
+            case column_type::date: return std::vector<table_date>();
+            case column_type::timestamp: return std::vector<table_timestamp>();
+#endif
+            default: return std::vector<std::string>();
+            }
+        }
+
+        // Entry of the per column dispatch table, resolved once from the schema so a cell costs an indirect call
+        // into the statically typed from_csv rather than a switch on the column type
+        struct table_appender
+        {
+            void * values;
+            void (*append)(void * values, csv_parser & parser);
+        };
+
+        template <typename T>
+        inline void append_table_value(void * values, csv_parser & parser)
+        {
+            static_cast<std::vector<T> *>(values)->push_back(from_csv<T>{ parser }());
+        }
+
+        FASTCSV_NO_DISCARD inline table_appender make_table_appender(table_column & column)
+        {
+            return std::visit(
+                [](auto & values) {
+                    using value_type = typename std::decay_t<decltype(values)>::value_type;
+                    return table_appender{ &values, &append_table_value<value_type> };
+                },
+                column);
+        }
+
+        template <typename TIntermediate>
+        void write_headers(output_buffer & out)
+        {
+            if constexpr (has_csv_headers<TIntermediate>)
+            {
+                auto first = true;
+                auto headers = csv_headers<TIntermediate>{}();
+                for (auto header : headers)
+                {
+                    if (!first) { out.push_back(default_column_delimiter<char>); }
+                    out.append(header);
+                    first = false;
+                }
+                out.append(default_line_delimiter<char>);
+            }
+        }
+
+        template <typename T, typename TIntermediate, typename TAdapter>
+        void write_rows(output_buffer & out, const std::vector<T> & data, size_t first, size_t last, TAdapter & adapter)
+        {
+            auto writer = to_csv<TIntermediate>{ out, true };
+
+            for (auto i = first; i < last; ++i)
+            {
+                writer.first = true;
+                writer.write(adapter(data[i]));
+                out.append(default_line_delimiter<char>);
+            }
+        }
+
+        // Rows formatted by each worker per round, large enough to amortise handing out the chunk
+        inline constexpr size_t parallel_chunk_rows = 1ul << 16;
+
+        FASTCSV_NO_DISCARD inline size_t parallel_threads() noexcept
+        {
+            return size_t{ std::max(std::thread::hardware_concurrency(), 1u) };
+        }
+
+        // Backs off between polls that found nothing to do, yielding at first and then sleeping so that an idle
+        // poller costs next to nothing while producers and consumers never block on each other
+        inline void back_off(size_t & polls)
+        {
+            if (++polls < 64ul) { std::this_thread::yield(); }
+            else { std::this_thread::sleep_for(std::chrono::microseconds(50)); }
+        }
+
+        // Threads kept for a whole parallel write. run() hands every round to the same workers, so a save starts its
+        // threads once rather than once per round, and idle workers poll with back_off until the next round
+        class round_workers
+        {
+        public:
+            explicit round_workers(size_t threads) : errors_(std::max(threads, size_t{ 1 }))
+            {
+                try
+                {
+                    for (auto i = 1ul; i < errors_.size(); ++i)
+                    {
+                        threads_.emplace_back([this, i]() { work(i); });
+                    }
+                }
+                catch (...)
+                {
+                    stop();
+                    throw;
+                }
+            }
+
+            round_workers(const round_workers &) = delete;
+            round_workers & operator=(const round_workers &) = delete;
+
+            ~round_workers() { stop(); }
+
+            FASTCSV_NO_DISCARD size_t size() const noexcept { return errors_.size(); }
+
+            // Calls task(i) for every i below count, at most size(), with task(0) on the calling thread. Returns once
+            // every call has, rethrowing the exception of the first that failed
+            template <typename TTask>
+            void run(size_t count, TTask & task)
+            {
+                task_ = [&task](size_t i) { task(i); };
+                count_ = count;
+                std::fill(errors_.begin(), errors_.end(), nullptr);
+                pending_.store(threads_.size(), std::memory_order_relaxed);
+                round_.fetch_add(1ul, std::memory_order_release);
+
+                call(0ul);
+
+                auto polls = 0ul;
+                while (pending_.load(std::memory_order_acquire) != 0ul)
+                {
+                    back_off(polls);
+                }
+
+                for (const auto & error : errors_)
+                {
+                    if (error != nullptr) { std::rethrow_exception(error); }
+                }
+            }
+
+        private:
+            void call(size_t index) noexcept
+            {
+                try
+                {
+                    task_(index);
+                }
+                catch (...)
+                {
+                    errors_[index] = std::current_exception();
+                }
+            }
+
+            void work(size_t index)
+            {
+                auto seen = 0ul;
+                auto polls = 0ul;
+                while (true)
+                {
+                    const auto round = round_.load(std::memory_order_acquire);
+                    if (round == seen)
+                    {
+                        if (stop_.load(std::memory_order_acquire)) { return; }
+                        back_off(polls);
+                        continue;
+                    }
+
+                    seen = round;
+                    polls = 0ul;
+                    if (index < count_) { call(index); }
+                    pending_.fetch_sub(1ul, std::memory_order_release);
+                }
+            }
+
+            void stop() noexcept
+            {
+                stop_.store(true, std::memory_order_release);
+                for (auto & thread : threads_)
+                {
+                    thread.join();
+                }
+                threads_.clear();
+            }
+
+            std::vector<std::exception_ptr> errors_;
+            std::vector<std::thread> threads_;
+            std::function<void(size_t)> task_;
+            size_t count_ = 0ul;
+            std::atomic<size_t> round_{ 0ul };
+            std::atomic<size_t> pending_{ 0ul };
+            std::atomic<bool> stop_{ false };
+        };
+
+        // Formats data in rounds of one chunk of rows per worker, each into its own buffer, and passes every round to
+        // sink(buffers, count) in row order so memory stays bounded by a round whatever the size of data
+        template <typename T, typename TIntermediate, typename TAdapter, typename TSink>
+        void format_parallel(
+            const std::vector<T> & data,
+            TAdapter & adapter,
+            std::optional<no_header_tag> noHeader,
+            round_workers & workers,
+            TSink sink)
+        {
+            auto buffers = std::vector<output_buffer>(workers.size());
+
+            auto row = 0ul;
+            do
+            {
+                const auto chunkCount = std::clamp(
+                    (data.size() - row + parallel_chunk_rows - 1ul) / parallel_chunk_rows,
+                    size_t{ 1 },
+                    workers.size());
+
+                auto format = [&, row](size_t i) {
+                    buffers[i].clear();
+                    if (i == 0ul && row == 0ul && !noHeader.has_value()) { write_headers<TIntermediate>(buffers[0]); }
+                    const auto first = row + i * parallel_chunk_rows;
+                    const auto last = std::min(first + parallel_chunk_rows, data.size());
+                    write_rows<T, TIntermediate>(buffers[i], data, first, last, adapter);
+                };
+                workers.run(chunkCount, format);
+
+                sink(static_cast<const std::vector<output_buffer> &>(buffers), chunkCount);
+                row = std::min(row + chunkCount * parallel_chunk_rows, data.size());
+            }
+            while (row < data.size());
+        }
+
+        // Opens filePath for a save, which must carry the csv extension, and throws when the file cannot be created
+        FASTCSV_NO_DISCARD inline std::ofstream open_csv_output(const std::filesystem::path & filePath)
+        {
+            if (filePath.extension() != csv_extension<char>)
+            {
+                throw fastcsv_exception(fmt::format(
+                    "File does not have the required '{}' extension: {}  {} {}",
+                    csv_extension<char>,
+                    filePath.string(),
+                    __FILE__,
+                    __LINE__));
+            }
+
+            auto file = std::ofstream(filePath, std::ios::out | std::ios::binary);
+            if (!file)
+            {
+                throw fastcsv_exception(
+                    fmt::format("Could not open file for writing: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+            return file;
+        }
+
+        // Flushes and closes a file written by a save, throwing when any write to it failed
+        inline void close_csv_output(std::ofstream & file, const std::filesystem::path & filePath)
+        {
+            file.flush();
+            file.close();
+            if (!file)
+            {
+                throw fastcsv_exception(
+                    fmt::format("Failed to write file: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+        }
+
+#if defined(FASTCSV_PLATFORM_LINUX)
+        // Reports a failed system call on target with the message of error, errno by default
+        [[noreturn]] inline void throw_errno(std::string_view operation, const std::string & target, int error = errno)
+        {
+            throw fastcsv_exception(fmt::format(
+                "Failed to {} '{}': {}  {} {}", operation, target, std::strerror(error), __FILE__, __LINE__));
+        }
+
+        // Passes advice on a range of fd to the kernel, posix_fadvise returns its error rather than set errno
+        inline void advise(int fd, size_t offset, size_t length, int advice, const std::string & target)
+        {
+            const auto error = ::posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(length), advice);
+            if (error != 0) { throw_errno("advise the kernel on", target, error); }
+        }
+
+        // Owns a file opened for positioned writes, which several threads may issue at once
+        class positioned_file
+        {
+        public:
+            explicit positioned_file(const std::filesystem::path & filePath)
+              : path_(filePath.string()), fd_(::open(filePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644))
+            {
+                if (fd_ < 0) { throw_errno("open", path_); }
+            }
+
+            positioned_file(const positioned_file &) = delete;
+            positioned_file & operator=(const positioned_file &) = delete;
+
+            // Only a fallback for saves that already failed, close() reports the errors this has to ignore
+            ~positioned_file()
+            {
+                if (fd_ >= 0) { ::close(fd_); }
+            }
+
+            // Closes the file, throwing when the kernel reports a write it could not complete only at this point, as
+            // network file systems do. The descriptor is released either way so close is never retried
+            void close()
+            {
+                if (::close(std::exchange(fd_, -1)) != 0) { throw_errno("close", path_); }
+            }
+
+            // Grows the file to size up front so the writes that follow only fill in allocated blocks. File systems
+            // without fallocate support are resized instead. posix_fallocate returns its error rather than set errno
+            void allocate(size_t size)
+            {
+                const auto error = ::posix_fallocate(fd_, 0, static_cast<off_t>(size));
+                if (error == 0) { return; }
+                if (error != EINVAL && error != EOPNOTSUPP) { throw_errno("allocate", std::to_string(size), error); }
+                if (::ftruncate(fd_, static_cast<off_t>(size)) != 0) { throw_errno("allocate", std::to_string(size)); }
+            }
+
+            void write_at(std::string_view chunk, size_t offset)
+            {
+                while (!chunk.empty())
+                {
+                    const auto written = ::pwrite(fd_, chunk.data(), chunk.size(), static_cast<off_t>(offset));
+                    if (written < 0)
+                    {
+                        if (errno == EINTR) { continue; }
+                        throw_errno("write", std::to_string(offset));
+                    }
+
+                    chunk.remove_prefix(static_cast<size_t>(written));
+                    offset += static_cast<size_t>(written);
+                }
+            }
+
+        private:
+            std::string path_;
+            int fd_;
+        };
+
+        // Bytes read per call when reading around the page cache
+        inline constexpr size_t uncached_read_block = 8ul << 20;
+
+        // Reads the file sequentially in large blocks straight into the result, telling the kernel to read ahead and
+        // to drop each block from the page cache once it is copied out so a single pass over a huge file does not
+        // evict the working set of everything else on the machine
+        FASTCSV_NO_DISCARD inline std::string read_uncached(const std::filesystem::path & filePath)
+        {
+            const auto fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) { throw_errno("open", filePath.string()); }
+
+            auto content = std::string();
+            try
+            {
+                content.resize(static_cast<size_t>(std::filesystem::file_size(filePath)));
+                advise(fd, 0ul, 0ul, POSIX_FADV_SEQUENTIAL, filePath.string());
+
+                auto offset = 0ul;
+                while (offset < content.size())
+                {
+                    const auto count = std::min(uncached_read_block, content.size() - offset);
+                    const auto bytes = ::read(fd, content.data() + offset, count);
+                    if (bytes < 0)
+                    {
+                        if (errno == EINTR) { continue; }
+                        throw_errno("read", filePath.string());
+                    }
+                    if (bytes == 0)
+                    {
+                        throw fastcsv_exception(fmt::format(
+                            "Could not read full contents of file: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+                    }
+
+                    advise(fd, offset, static_cast<size_t>(bytes), POSIX_FADV_DONTNEED, filePath.string());
+                    offset += static_cast<size_t>(bytes);
+                }
+            }
+            catch (...)
+            {
+                ::close(fd);
+                throw;
+            }
+
+            ::close(fd);
+            return content;
+        }
+#endif
+
+    }  // namespace detail
+
+    namespace detail
+    {
+
+        // Converts the rows of content onto the end of data. row is the line content starts on and is advanced past
+        // its lines, with firstOffset it places errors within a larger input. False when the policy stopped reading
+        template <typename T, typename TIntermediate, typename TAdapter>
+        bool read_rows(
+            const std::string & content,
+            TAdapter & adapter,
+            error_policy policy,
+            std::vector<csv_error> & errors,
+            std::optional<no_header_tag> noHeaderOption,
+            std::vector<T> & data,
+            size_t & row,
+            size_t firstOffset)
+        {
+            auto parser = csv_parser(content, default_column_delimiter<char>, quote<char>, escape<char>);
+            parser.record_errors(policy != error_policy::throw_exception);
+
+            const auto firstLine = row;
+            if (!noHeaderOption.has_value())
+            {
+                parser.advance_line();
+                ++row;
+            }
+
+            try
+            {
+                while (!parser.end_of_file())
+                {
+                    if (policy == error_policy::throw_exception)
+                    {
+                        data.emplace_back(adapter(from_csv<TIntermediate>{ parser }()));
+                    }
+                    else if (auto value = convert_row<TIntermediate>(parser); !parser.has_error())
+                    {
+                        data.emplace_back(adapter(std::move(*value)));
+                    }
+                    else if (!record_row_error(parser, policy, row, errors, firstOffset))
+                    {
+                        return false;
+                    }
+
+                    parser.advance_line();
+                    ++row;
+                }
+            }
+            catch (const fastcsv_exception & exception)
+            {
+                throw_located(content, parser, exception, firstLine, firstOffset);
+            }
+
+            return true;
+        }
+
+    }  // namespace detail
+
+    FASTCSV_CONSTEXPR inline detail::no_header_tag no_header{};
+
+    /// Formats rows on every hardware thread, to_csv and the adapter must be safe to call concurrently
+    FASTCSV_CONSTEXPR inline detail::parallel_tag parallel{};
+
+    /// Reads a file once without leaving it in the page cache, for single passes over files larger than the working
+    /// set. For a .csv.gz it is the compressed bytes that are dropped. Only changes anything on Linux, where advice
+    /// the kernel refuses is reported as a fastcsv_exception
+    FASTCSV_CONSTEXPR inline detail::uncached_tag uncached{};
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::vector<T> read_csv(
+        const std::string & content,
+        TAdapter adapter,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        if (content.empty()) { return std::vector<T>(); }
+
+        auto data = std::vector<T>();
+        // if (linesIterator.current_element_size() != 0ul)
+        // {
+        //     // Simple heuristic to estimate the total number of lines to avoid lots of vector resizing
+        //     auto estimatedNumberOfLines = content.size() / linesIterator.current_element_size();
+        //     data.reserve(estimatedNumberOfLines);
+        // }
+
+        auto row = 0ul;
+        detail::read_rows<T, TIntermediate>(content, adapter, policy, errors, noHeaderOption, data, row, 0ul);
+
+        return data;
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::vector<T> read_csv(
+        const std::string & content,
+        TAdapter adapter,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto errors = std::vector<csv_error>();
+        return read_csv<T, TIntermediate, TAdapter>(
+            content,
+            adapter,
+            error_policy::throw_exception,
+            errors,
+            noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::vector<T> read_csv(
+        const std::string & content,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return read_csv<T, T, detail::identity>(content, detail::identity{}, policy, errors, noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::vector<T> read_csv(
+        const std::string & content, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return read_csv<T, T, detail::identity>(content, detail::identity{}, noHeaderOption);
+    }
+
+    /// Sources of raw bytes for read_csv_source have size_t read(char * dest, size_t count), which fills dest with up
+    /// to count bytes and returns how many, zero once the input is exhausted
+    template <typename TSource, typename = void>
+    inline constexpr bool is_input_source_v = false;
+
+    template <typename TSource>
+    inline constexpr bool is_input_source_v<
+        TSource,
+        std::enable_if_t<
+            std::is_same_v<decltype(std::declval<TSource &>().read(std::declval<char *>(), size_t{})), size_t>>>
+        = true;
+
+    /// Reads the bytes of a file as they are
+    class file_source
+    {
+    public:
+        explicit file_source(const std::filesystem::path & filePath) : file_(filePath, std::ios::in | std::ios::binary)
+        {
+            if (!file_)
+            {
+                throw fastcsv_exception(
+                    fmt::format("Cannot open file: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+        }
+
+        FASTCSV_NO_DISCARD size_t read(char * dest, size_t count)
+        {
+            file_.read(dest, static_cast<std::streamsize>(count));
+            return static_cast<size_t>(file_.gcount());
+        }
+
+    private:
+        std::ifstream file_;
+    };
+
+#if defined(FASTCSV_HAS_ZLIB)
+    /// Inflates a gzip file, concatenated gzip members are read one after the other. With uncached, zlib reads
+    /// through a descriptor of the source's own and every compressed byte it consumed is dropped from the page cache
+    /// after each read. The flag is ignored on platforms without posix_fadvise
+    class gzip_source
+    {
+    public:
+        explicit gzip_source(const std::filesystem::path & filePath, bool uncached = false)
+          : path_(filePath.string()), file_(nullptr), fd_(-1), dropped_(0ul)
+        {
+#if defined(FASTCSV_PLATFORM_LINUX)
+            if (uncached)
+            {
+                fd_ = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd_ < 0) { detail::throw_errno("open", path_); }
+
+                file_ = ::gzdopen(fd_, "rb");
+                if (file_ == nullptr) { ::close(fd_); }
+            }
+            else { file_ = ::gzopen(path_.c_str(), "rb"); }
+#else
+            (void)uncached;
+            file_ = ::gzopen(path_.c_str(), "rb");
+#endif
+
+            if (file_ == nullptr)
+            {
+                throw fastcsv_exception(fmt::format("Cannot open file: {}  {} {}", path_, __FILE__, __LINE__));
+            }
+            ::gzbuffer(file_, buffer_size);
+        }
+
+        gzip_source(gzip_source && other) noexcept
+          : path_(std::move(other.path_)),
+            file_(std::exchange(other.file_, nullptr)),
+            fd_(std::exchange(other.fd_, -1)),
+            dropped_(other.dropped_)
+        {
+        }
+
+        gzip_source(const gzip_source &) = delete;
+        gzip_source & operator=(const gzip_source &) = delete;
+        gzip_source & operator=(gzip_source &&) = delete;
+
+        ~gzip_source()
+        {
+            if (file_ != nullptr) { ::gzclose(file_); }
+        }
+
+        FASTCSV_NO_DISCARD size_t read(char * dest, size_t count)
+        {
+            const auto bytes = ::gzread(file_, dest, static_cast<unsigned>(std::min(count, max_read)));
+            if (bytes < 0)
+            {
+                auto code = 0;
+                throw fastcsv_exception(
+                    fmt::format("Failed to inflate: {}  {} {}", ::gzerror(file_, &code), __FILE__, __LINE__));
+            }
+
+#if defined(FASTCSV_PLATFORM_LINUX)
+            if (fd_ >= 0) { drop_consumed(); }
+#endif
+            return static_cast<size_t>(bytes);
+        }
+
+    private:
+#if defined(FASTCSV_PLATFORM_LINUX)
+        // zlib reads the descriptor sequentially, so its offset is how much of the file has been consumed
+        void drop_consumed()
+        {
+            const auto consumed = ::lseek(fd_, 0, SEEK_CUR);
+            if (consumed < 0) { detail::throw_errno("seek", path_); }
+
+            if (static_cast<size_t>(consumed) > dropped_)
+            {
+                detail::advise(fd_, dropped_, static_cast<size_t>(consumed) - dropped_, POSIX_FADV_DONTNEED, path_);
+                dropped_ = static_cast<size_t>(consumed);
+            }
+        }
+#endif
+
+        // zlib's input buffer, larger than its 8K default to cut the number of file reads
+        static constexpr unsigned buffer_size = 1u << 17;
+        static constexpr size_t max_read = 1ul << 30;
+
+        std::string path_;
+        gzFile file_;
+        // only open for uncached reads, closed by gzclose
+        int fd_;
+        size_t dropped_;
+    };
+#endif
+
+    /// Runs another source on a background thread that reads blocks ahead into a small ring of buffers, so that slow
+    /// sources such as inflating a gzip file overlap with parsing what they have already produced
+    template <typename TSource>
+    class pipelined_source
+    {
+    public:
+        static constexpr size_t block_size = 1ul << 20;
+        static constexpr size_t block_count = 4ul;
+
+        explicit pipelined_source(TSource source)
+          : source_(std::move(source)),
+            blocks_(),
+            produced_(0ul),
+            consumed_(0ul),
+            stopping_(false),
+            done_(false),
+            error_(),
+            holding_(false),
+            position_(0ul),
+            producer_([this]() { run(); })
+        {
+        }
+
+        pipelined_source(const pipelined_source &) = delete;
+        pipelined_source & operator=(const pipelined_source &) = delete;
+
+        ~pipelined_source()
+        {
+            stopping_.store(true, std::memory_order_release);
+            producer_.join();
+        }
+
+        FASTCSV_NO_DISCARD size_t read(char * dest, size_t count)
+        {
+            auto total = 0ul;
+            while (total < count)
+            {
+                if ((!holding_ || position_ == current().size) && !next_block()) { break; }
+
+                const auto bytes = std::min(count - total, current().size - position_);
+                std::memcpy(dest + total, current().data.get() + position_, bytes);
+                total += bytes;
+                position_ += bytes;
+            }
+            return total;
+        }
+
+    private:
+        struct block
+        {
+            std::unique_ptr<char[]> data;
+            size_t size;
+        };
+
+        block & current() noexcept { return blocks_[consumed_.load(std::memory_order_relaxed) % block_count]; }
+
+        // Hands the exhausted block back to the producer and waits for the next one, false at the end of the source
+        bool next_block()
+        {
+            auto consumed = consumed_.load(std::memory_order_relaxed);
+            if (holding_)
+            {
+                consumed_.store(++consumed, std::memory_order_release);
+                holding_ = false;
+            }
+
+            auto polls = 0ul;
+            while (produced_.load(std::memory_order_acquire) == consumed)
+            {
+                if (done_.load(std::memory_order_acquire))
+                {
+                    // the producer may have finished a block just before stopping
+                    if (produced_.load(std::memory_order_acquire) != consumed) { break; }
+                    if (error_ != nullptr) { std::rethrow_exception(error_); }
+                    return false;
+                }
+                detail::back_off(polls);
+            }
+
+            holding_ = true;
+            position_ = 0ul;
+            return true;
+        }
+
+        void run()
+        {
+            try
+            {
+                auto produced = 0ul;
+                while (!stopping_.load(std::memory_order_acquire))
+                {
+                    if (produced - consumed_.load(std::memory_order_acquire) == block_count)
+                    {
+                        auto polls = 0ul;
+                        while (produced - consumed_.load(std::memory_order_acquire) == block_count)
+                        {
+                            if (stopping_.load(std::memory_order_acquire)) { return; }
+                            detail::back_off(polls);
+                        }
+                    }
+
+                    auto & next = blocks_[produced % block_count];
+                    if (next.data == nullptr) { next.data = std::make_unique<char[]>(block_size); }
+
+                    // fill the whole block so the consumer moves on once per block
+                    next.size = 0ul;
+                    while (next.size < block_size)
+                    {
+                        const auto bytes = source_.read(next.data.get() + next.size, block_size - next.size);
+                        if (bytes == 0ul) { break; }
+                        next.size += bytes;
+                    }
+
+                    if (next.size == 0ul) { break; }
+                    produced_.store(++produced, std::memory_order_release);
+                }
+            }
+            catch (...)
+            {
+                error_ = std::current_exception();
+            }
+            done_.store(true, std::memory_order_release);
+        }
+
+        TSource source_;
+        std::array<block, block_count> blocks_;
+        // blocks filled by the producer and released by the consumer, the difference is the number in flight
+        std::atomic<size_t> produced_;
+        std::atomic<size_t> consumed_;
+        std::atomic<bool> stopping_;
+        std::atomic<bool> done_;
+        // written by the producer before it sets done_
+        std::exception_ptr error_;
+        // only touched by the consumer
+        bool holding_;
+        size_t position_;
+        // started last, once everything it uses is constructed
+        std::thread producer_;
+    };
+
+    namespace detail
+    {
+
+        // Bytes read from a source per call, and gathered before the complete rows among them are converted
+        inline constexpr size_t source_read_size = 1ul << 20;
+        inline constexpr size_t source_batch_size = 4ul << 20;
+
+        // Finds the end of the last complete record in text that keeps growing at the back and being cut at the front,
+        // looking at each character once. Line ends inside quoted fields are not record ends, and an escaped quote
+        // within a quoted field does not close it, the same as find_column_end. A record ends at '\n', or at a '\r'
+        // the parser accepts alone, which is only known once the character after it has arrived
+        class record_splitter
+        {
+        public:
+            record_splitter() : inside_(false), escaped_(false), carriage_(false), scanned_(0ul), end_(0ul) {}
+
+            // One past the last record end in text, zero when there is none yet
+            FASTCSV_NO_DISCARD size_t scan(std::string_view text) noexcept
+            {
+                for (; scanned_ < text.size(); ++scanned_)
+                {
+                    const auto c = text[scanned_];
+                    if (std::exchange(carriage_, false) && c != '\n') { end_ = scanned_; }
+                    if (std::exchange(escaped_, false) && c == quote<char>) { continue; }
+
+                    if (c == quote<char>) { inside_ = !inside_; }
+                    else if (inside_ && c == escape<char>) { escaped_ = true; }
+                    else if (c == '\n' && !inside_) { end_ = scanned_ + 1ul; }
+                    else if (c == '\r' && !inside_) { carriage_ = true; }
+                }
+                return end_;
+            }
+
+            // The first count characters were cut from the text
+            void consume(size_t count) noexcept
+            {
+                scanned_ -= count;
+                end_ = 0ul;
+            }
+
+        private:
+            bool inside_;
+            // the last character scanned is an escape inside a quoted field
+            bool escaped_;
+            // the last character scanned is a '\r' outside quotes, a record end unless a '\n' follows
+            bool carriage_;
+            size_t scanned_;
+            size_t end_;
+        };
+
+        FASTCSV_NO_DISCARD inline bool is_gzip_csv(const std::filesystem::path & filePath)
+        {
+            return filePath.extension() == gzip_extension<char> && filePath.stem().extension() == csv_extension<char>;
+        }
+
+    }  // namespace detail
+
+    /// Reads rows from a source as it produces them, converting the complete rows each time a few megabytes have
+    /// arrived so memory holds the rows and one batch of text rather than the whole input. Error rows, offsets and
+    /// locations are within the whole input
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter, typename TSource>
+        requires is_input_source_v<TSource>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        typename TSource,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate> && is_input_source_v<TSource>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::vector<T> read_csv_source(
+        TSource & source,
+        TAdapter adapter,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto data = std::vector<T>();
+        auto row = 0ul;
+        auto offset = 0ul;
+        auto headerOption = noHeaderOption;
+        auto pending = std::string();
+        auto splitter = detail::record_splitter();
+
+        while (true)
+        {
+            const auto size = pending.size();
+            pending.resize(size + detail::source_read_size);
+            const auto bytes = source.read(pending.data() + size, detail::source_read_size);
+            pending.resize(size + bytes);
+            const auto exhausted = bytes == 0ul;
+
+            auto end = pending.size();
+            if (!exhausted)
+            {
+                end = splitter.scan(pending);
+                if (pending.size() < detail::source_batch_size || end == 0ul) { continue; }
+            }
+
+            auto rest = pending.substr(end);
+            pending.resize(end);
+            if (!pending.empty()
+                && !detail::read_rows<T, TIntermediate>(
+                    pending, adapter, policy, errors, headerOption, data, row, offset))
+            {
+                break;
+            }
+
+            offset += end;
+            headerOption = no_header;
+            pending = std::move(rest);
+            splitter.consume(end);
+
+            if (exhausted) { break; }
+        }
+
+        return data;
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter, typename TSource>
+        requires is_input_source_v<TSource>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        typename TSource,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate> && is_input_source_v<TSource>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::vector<T> read_csv_source(
+        TSource & source, TAdapter adapter, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto errors = std::vector<csv_error>();
+        return read_csv_source<T, TIntermediate, TAdapter>(
+            source,
+            adapter,
+            error_policy::throw_exception,
+            errors,
+            noHeaderOption);
+    }
+
+    template <typename T, typename TSource, std::enable_if_t<is_input_source_v<TSource>> * = nullptr>
+    FASTCSV_NO_DISCARD std::vector<T> read_csv_source(
+        TSource & source,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return read_csv_source<T, T, detail::identity>(source, detail::identity{}, policy, errors, noHeaderOption);
+    }
+
+    template <typename T, typename TSource, std::enable_if_t<is_input_source_v<TSource>> * = nullptr>
+    FASTCSV_NO_DISCARD std::vector<T> read_csv_source(
+        TSource & source, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return read_csv_source<T, T, detail::identity>(source, detail::identity{}, noHeaderOption);
+    }
+
+    namespace detail
+    {
+
+        // Reads the whole of a .csv file into memory
+        FASTCSV_NO_DISCARD inline std::string load_file(const std::filesystem::path & filePath, bool uncached = false)
+        {
+            if (!std::filesystem::exists(filePath) || !std::filesystem::is_regular_file(filePath))
+            {
+                throw fastcsv_exception(
+                    fmt::format("File does not exist: '{}'  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+
+            if (filePath.extension() != detail::csv_extension<char>)
+            {
+                throw fastcsv_exception(fmt::format(
+                    "File does not have the required '{}' extension: {}  {} {}",
+                    detail::csv_extension<char>,
+                    filePath.string(),
+                    __FILE__,
+                    __LINE__));
+            }
+
+#if defined(FASTCSV_PLATFORM_LINUX)
+            if (uncached) { return read_uncached(filePath); }
+#else
+            (void)uncached;
+#endif
+
+            // ToDo: use memory mapped files
+            auto file = std::ifstream(filePath, std::ios::in | std::ios::binary);
+
+            if (!file)
+            {
+                throw fastcsv_exception(
+                    fmt::format("Cannot open file: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+
+            std::string content;
+            content.resize(static_cast<size_t>(std::filesystem::file_size(filePath)));
+            file.read(content.data(), content.size());
+
+            if (!file)
+            {
+                throw fastcsv_exception(fmt::format(
+                    "Could not read full contents of file: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+
+            return content;
+        }
+
+    }  // namespace detail
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::vector<T> load_csv(
+        const std::filesystem::path & filePath,
+        TAdapter adapter,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+#if defined(FASTCSV_HAS_ZLIB)
+        if (detail::is_gzip_csv(filePath))
+        {
+            if (!std::filesystem::is_regular_file(filePath))
+            {
+                throw fastcsv_exception(
+                    fmt::format("File does not exist: '{}'  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+
+            auto source = pipelined_source<gzip_source>(gzip_source(filePath));
+            return read_csv_source<T, TIntermediate, TAdapter>(source, adapter, policy, errors, noHeaderOption);
+        }
+#endif
+
+        const auto content = detail::load_file(filePath);
+        return read_csv<T, TIntermediate, TAdapter>(content, adapter, policy, errors, noHeaderOption);
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::vector<T> load_csv(
+        const std::filesystem::path & filePath,
+        TAdapter adapter,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto errors = std::vector<csv_error>();
+        return load_csv<T, TIntermediate, TAdapter>(
+            filePath,
+            adapter,
+            error_policy::throw_exception,
+            errors,
+            noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::vector<T> load_csv(
+        const std::filesystem::path & filePath,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return load_csv<T, T, detail::identity>(filePath, detail::identity{}, policy, errors, noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::vector<T> load_csv(
+        const std::filesystem::path & filePath, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return load_csv<T, T, detail::identity>(filePath, detail::identity{}, noHeaderOption);
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::vector<T> load_csv(
+        const std::filesystem::path & filePath,
+        TAdapter adapter,
+        detail::uncached_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+#if defined(FASTCSV_HAS_ZLIB)
+        // streamed in batches already, the source drops the compressed bytes from the page cache as it reads them
+        if (detail::is_gzip_csv(filePath))
+        {
+            if (!std::filesystem::is_regular_file(filePath))
+            {
+                throw fastcsv_exception(
+                    fmt::format("File does not exist: '{}'  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
+
+            auto source = pipelined_source<gzip_source>(gzip_source(filePath, true));
+            return read_csv_source<T, TIntermediate, TAdapter>(source, adapter, noHeaderOption);
+        }
+#endif
+
+        const auto content = detail::load_file(filePath, true);
+        return read_csv<T, TIntermediate, TAdapter>(content, adapter, noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::vector<T> load_csv(
+        const std::filesystem::path & filePath,
+        detail::uncached_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return load_csv<T, T, detail::identity>(filePath, detail::identity{}, uncached, noHeaderOption);
+    }
+
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
+#endif
+    void write_csv(
+        output_buffer & out,
+        const std::vector<T> & data,
+        TAdapter adapter,
+        std::optional<detail::no_header_tag> noHeader = std::nullopt)
+    {
+        if (!noHeader.has_value()) { detail::write_headers<TIntermediate>(out); }
+
+        detail::write_rows<T, TIntermediate>(out, data, 0ul, data.size(), adapter);
+    }
+
+    template <typename T>
+    void write_csv(
+        output_buffer & out,
+        const std::vector<T> & data,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        write_csv<T, T, detail::identity>(out, data, detail::identity{}, noHeaderOption);
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
+#endif
+    void write_csv(
+        std::ostream & os,
+        const std::vector<T> & data,
+        TAdapter adapter,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto out = output_buffer(os);
+        write_csv<T, TIntermediate, TAdapter>(out, data, adapter, noHeaderOption);
+        out.flush();
+    }
+
+    template <typename T>
+    void write_csv(
+        std::ostream & os,
+        const std::vector<T> & data,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        write_csv<T, T, detail::identity>(os, data, detail::identity{}, noHeaderOption);
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::string write_csv(
+        const std::vector<T> & data,
+        TAdapter adapter,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto out = output_buffer();
+        write_csv<T, TIntermediate, TAdapter>(out, data, adapter, noHeaderOption);
+        return std::string(out.view());
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::string write_csv(
+        const std::vector<T> & data, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return write_csv<T, T, detail::identity>(data, detail::identity{}, noHeaderOption);
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
+#endif
+    void save_csv(
+        const std::filesystem::path & filePath,
+        const std::vector<T> & data,
+        TAdapter adapter,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto file = detail::open_csv_output(filePath);
+        write_csv<T, TIntermediate, TAdapter>(file, data, adapter, noHeaderOption);
+        detail::close_csv_output(file, filePath);
+    }
+
+    template <typename T>
+    void save_csv(
+        const std::filesystem::path & filePath,
+        const std::vector<T> & data,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        save_csv<T, T, detail::identity>(filePath, data, detail::identity{}, noHeaderOption);
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
+#endif
+    void write_csv(
+        std::ostream & os,
+        const std::vector<T> & data,
+        TAdapter adapter,
+        detail::parallel_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto workers = detail::round_workers(detail::parallel_threads());
+        detail::format_parallel<T, TIntermediate>(
+            data,
+            adapter,
+            noHeaderOption,
+            workers,
+            [&os](const std::vector<output_buffer> & buffers, size_t count) {
+                for (auto i = 0ul; i < count; ++i)
+                {
+                    os.write(buffers[i].view().data(), static_cast<std::streamsize>(buffers[i].size()));
+                }
+            });
+    }
+
+    template <typename T>
+    void write_csv(
+        std::ostream & os,
+        const std::vector<T> & data,
+        detail::parallel_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        write_csv<T, T, detail::identity>(os, data, detail::identity{}, parallel, noHeaderOption);
+    }
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::string write_csv(
+        const std::vector<T> & data,
+        TAdapter adapter,
+        detail::parallel_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto result = std::string();
+        auto workers = detail::round_workers(detail::parallel_threads());
+        detail::format_parallel<T, TIntermediate>(
+            data,
+            adapter,
+            noHeaderOption,
+            workers,
+            [&result](const std::vector<output_buffer> & buffers, size_t count) {
+                for (auto i = 0ul; i < count; ++i)
+                {
+                    result.append(buffers[i].view());
+                }
+            });
+        return result;
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::string write_csv(
+        const std::vector<T> & data,
+        detail::parallel_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return write_csv<T, T, detail::identity>(data, detail::identity{}, parallel, noHeaderOption);
+    }
+
+    /// Formats chunks of rows on every hardware thread. Each round of chunks is placed with a prefix sum of their
+    /// sizes and written concurrently with pwrite into the file grown to fit them
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
+#endif
+    void save_csv(
+        const std::filesystem::path & filePath,
+        const std::vector<T> & data,
+        TAdapter adapter,
+        detail::parallel_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+#if defined(FASTCSV_PLATFORM_LINUX)
+        if (filePath.extension() != detail::csv_extension<char>)
+        {
+            throw fastcsv_exception(fmt::format(
+                "File does not have the required '{}' extension: {}  {} {}",
+                detail::csv_extension<char>,
+                filePath.string(),
+                __FILE__,
+                __LINE__));
+        }
+
+        auto file = detail::positioned_file(filePath);
+        auto workers = detail::round_workers(detail::parallel_threads());
+        auto offset = 0ul;
+
+        detail::format_parallel<T, TIntermediate>(
+            data,
+            adapter,
+            noHeaderOption,
+            workers,
+            [&](const std::vector<output_buffer> & buffers, size_t count) {
+                auto offsets = std::vector<size_t>(count + 1ul, offset);
+                for (auto i = 0ul; i < count; ++i)
+                {
+                    offsets[i + 1ul] = offsets[i] + buffers[i].size();
+                }
+                file.allocate(offsets[count]);
+
+                auto write = [&](size_t i) { file.write_at(buffers[i].view(), offsets[i]); };
+                workers.run(count, write);
+                offset = offsets[count];
+            });
+        file.close();
+#else
+        auto file = detail::open_csv_output(filePath);
+        write_csv<T, TIntermediate, TAdapter>(file, data, adapter, parallel, noHeaderOption);
+        detail::close_csv_output(file, filePath);
+#endif
+    }
+
+    template <typename T>
+    void save_csv(
+        const std::filesystem::path & filePath,
+        const std::vector<T> & data,
+        detail::parallel_tag,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        save_csv<T, T, detail::identity>(filePath, data, detail::identity{}, parallel, noHeaderOption);
+    }
+
+    /// Long lived writer appending rows to a file as they arrive, the header is written once on opening. Rows are
+    /// buffered and flushed to the file once flushSize elements are buffered or flushInterval has passed since the
+    /// last flush. Both are only checked on append and flush_if_due, the writer starts no timer of its own, so a
+    /// writer that goes idle should have flush_if_due called periodically or flush() called directly. flushSize is
+    /// capped at output_buffer::block_size, the buffer writes a full block through to the file by itself
+    template <typename T>
+    class csv_file_writer
+    {
+    public:
+        explicit csv_file_writer(
+            const std::filesystem::path & filePath,
+            std::optional<detail::no_header_tag> noHeader = std::nullopt,
+            size_t flushSize = output_buffer::block_size,
+            std::chrono::milliseconds flushInterval = std::chrono::seconds(1))
+          : file_(detail::open_csv_output(filePath)),
+            out_(file_),
+            flushSize_(std::min(flushSize, output_buffer::block_size)),
+            flushInterval_(flushInterval),
+            lastFlush_(std::chrono::steady_clock::now()),
+            rows_(0ul)
+        {
+            if (!noHeader.has_value()) { detail::write_headers<T>(out_); }
+        }
+
+        csv_file_writer(const csv_file_writer &) = delete;
+        csv_file_writer & operator=(const csv_file_writer &) = delete;
+
+        void append(const T & value)
+        {
+            write(value);
+            flush_if_due();
+        }
+
+        void append(const std::vector<T> & values)
+        {
+            for (const auto & value : values)
+            {
+                write(value);
+            }
+            flush_if_due();
+        }
+
+        /// Writes the buffered rows through to the file
+        void flush()
+        {
+            out_.flush();
+            file_.flush();
+            lastFlush_ = std::chrono::steady_clock::now();
+        }
+
+        /// Flushes when flushSize elements are buffered or flushInterval has passed since the last flush
+        inline void flush_if_due()
+        {
+            if (out_.size() >= flushSize_ || std::chrono::steady_clock::now() - lastFlush_ >= flushInterval_)
+            {
+                flush();
+            }
+        }
+
+        FASTCSV_NO_DISCARD size_t rows() const noexcept { return rows_; }
+
+    private:
+        inline void write(const T & value)
+        {
+            to_csv<T>{ out_, true }.write(value);
+            out_.append(detail::default_line_delimiter<char>);
+            ++rows_;
+        }
+
+        // declared before out_ so the buffer is flushed into it before the file closes
+        std::ofstream file_;
+        output_buffer out_;
+        size_t flushSize_;
+        std::chrono::milliseconds flushInterval_;
+        std::chrono::steady_clock::time_point lastFlush_;
+        size_t rows_;
+    };
+
+    namespace detail
+    {
+
+        // Bounded lock free ring for many producers and one consumer. Each slot carries a sequence number telling a
+        // producer claiming position p that the slot is free (p) and the consumer that it holds a value (p + 1). The
+        // capacity is rounded up to a power of two of at least 2 and may not exceed 2^63. The top bit of the tail
+        // marks the ring closed, so a claim and a close never both succeed on the same tail
+        template <typename T>
+        class mpsc_ring
+        {
+            static_assert(std::is_nothrow_move_assignable_v<T>, "mpsc_ring requires a nothrow move assignable T");
+
+        public:
+            static constexpr size_t max_capacity = (std::numeric_limits<size_t>::max() >> 1u) + 1ul;
+
+            explicit mpsc_ring(size_t capacity)
+              : mask_(round_up(capacity) - 1ul),
+                slots_(std::make_unique<slot[]>(mask_ + 1ul)),
+                tail_(0ul),
+                head_(0ul)
+            {
+                for (auto i = 0ul; i <= mask_; ++i)
+                {
+                    slots_[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            FASTCSV_NO_DISCARD size_t capacity() const noexcept { return mask_ + 1ul; }
+
+            /// Returns false without touching value when the ring is full or closed. A copy that throws still
+            /// publishes its slot, marked for the consumer to skip, before the exception reaches the caller
+            template <typename U>
+            FASTCSV_NO_DISCARD bool try_push(U && value)
+            {
+                auto position = tail_.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    if ((position & closed_bit) != 0ul) { return false; }
+
+                    auto & target = slots_[position & mask_];
+                    const auto sequence = target.sequence.load(std::memory_order_acquire);
+                    const auto difference = static_cast<ptrdiff_t>(sequence - position);
+                    if (difference == 0)
+                    {
+                        if (tail_.compare_exchange_weak(position, position + 1ul, std::memory_order_relaxed))
+                        {
+                            try
+                            {
+                                target.value = std::forward<U>(value);
+                            }
+                            catch (...)
+                            {
+                                target.skipped = true;
+                                target.sequence.store(position + 1ul, std::memory_order_release);
+                                throw;
+                            }
+
+                            target.sequence.store(position + 1ul, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (difference < 0) { return false; }
+                    else { position = tail_.load(std::memory_order_relaxed); }
+                }
+            }
+
+            /// Only ever called from the consumer thread
+            FASTCSV_NO_DISCARD bool try_pop(T & value)
+            {
+                while (true)
+                {
+                    auto & target = slots_[head_ & mask_];
+                    if (target.sequence.load(std::memory_order_acquire) != head_ + 1ul) { return false; }
+
+                    const auto skipped = std::exchange(target.skipped, false);
+                    if (!skipped) { value = std::move(target.value); }
+                    target.sequence.store(head_ + mask_ + 1ul, std::memory_order_release);
+                    ++head_;
+                    if (!skipped) { return true; }
+                }
+            }
+
+            /// Refuses every later push. Pushes that claimed a slot before still complete
+            void close() noexcept { tail_.fetch_or(closed_bit, std::memory_order_acq_rel); }
+
+            FASTCSV_NO_DISCARD bool closed() const noexcept
+            {
+                return (tail_.load(std::memory_order_acquire) & closed_bit) != 0ul;
+            }
+
+            /// Only ever called from the consumer thread, true once closed and every claimed slot has been popped
+            FASTCSV_NO_DISCARD bool drained() const noexcept
+            {
+                const auto tail = tail_.load(std::memory_order_acquire);
+                return (tail & closed_bit) != 0ul && (tail & ~closed_bit) == head_;
+            }
+
+        private:
+            static constexpr size_t closed_bit = ~(std::numeric_limits<size_t>::max() >> 1u);
+
+            struct slot
+            {
+                std::atomic<size_t> sequence;
+                bool skipped = false;
+                T value;
+            };
+
+            FASTCSV_NO_DISCARD static size_t bit_width(size_t value) noexcept
+            {
+                auto result = 0ul;
+                for (; value != 0ul; value >>= 1ul)
+                {
+                    ++result;
+                }
+                return result;
+            }
+
+            FASTCSV_NO_DISCARD static size_t round_up(size_t capacity)
+            {
+                if (capacity > max_capacity)
+                {
+                    throw fastcsv_exception(fmt::format(
+                        "Ring capacity {} exceeds {}  {} {}", capacity, max_capacity, __FILE__, __LINE__));
+                }
+
+                return size_t{ 1ul } << bit_width(std::max(capacity, size_t{ 2ul }) - 1ul);
+            }
+
+            size_t mask_;
+            std::unique_ptr<slot[]> slots_;
+            // producers and the consumer each own a cache line
+            alignas(64) std::atomic<size_t> tail_;
+            alignas(64) size_t head_;
+        };
+
+    }  // namespace detail
+
+    /// Writer shared by many threads. Producers enqueue rows into a bounded lock free ring and a background thread
+    /// formats them with to_csv<T> and writes them through a csv_file_writer, flushing whenever the ring runs empty.
+    /// T must be default constructible and nothrow move assignable. Call close() once the producers are done, it
+    /// drains the ring, including rows whose push raced the close and succeeded, and rethrows a failure of the
+    /// background thread. Rows pushed after close() are refused
+    template <typename T>
+    class csv_queue_writer
+    {
+    public:
+        explicit csv_queue_writer(
+            const std::filesystem::path & filePath,
+            std::optional<detail::no_header_tag> noHeader = std::nullopt,
+            size_t capacity = 65536ul,
+            std::chrono::milliseconds flushInterval = std::chrono::seconds(1))
+          : ring_(capacity),
+            error_(),
+            file_(filePath, noHeader, output_buffer::block_size, flushInterval),
+            consumer_([this]() { run(); })
+        {
+        }
+
+        csv_queue_writer(const csv_queue_writer &) = delete;
+        csv_queue_writer & operator=(const csv_queue_writer &) = delete;
+
+        ~csv_queue_writer()
+        {
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+            }
+        }
+
+        /// Returns false when the ring is full or the writer is closed, the row is then left with the caller
+        FASTCSV_NO_DISCARD bool try_push(const T & value) { return ring_.try_push(value); }
+
+        FASTCSV_NO_DISCARD bool try_push(T && value) { return ring_.try_push(std::move(value)); }
+
+        /// Spins until the row fits in the ring, throws once the writer is closed
+        void push(const T & value)
+        {
+            while (!try_push(value))
+            {
+                throw_if_closing();
+                std::this_thread::yield();
+            }
+        }
+
+        void push(T && value)
+        {
+            while (!try_push(std::move(value)))
+            {
+                throw_if_closing();
+                std::this_thread::yield();
+            }
+        }
+
+        void close()
+        {
+            if (!consumer_.joinable()) { return; }
+
+            ring_.close();
+            consumer_.join();
+
+            if (error_ != nullptr) { std::rethrow_exception(std::exchange(error_, nullptr)); }
+            file_.flush();
+        }
+
+    private:
+        void throw_if_closing() const
+        {
+            if (ring_.closed())
+            {
+                throw fastcsv_exception(fmt::format("Push to a closed csv_queue_writer  {} {}", __FILE__, __LINE__));
+            }
+        }
+
+        void run()
+        {
+            auto value = T();
+            auto pending = false;
+            auto polls = 0ul;
+
+            while (true)
+            {
+                if (ring_.try_pop(value))
+                {
+                    write(value);
+                    pending = true;
+                    polls = 0ul;
+                    continue;
+                }
+
+                // a producer may have claimed a slot just before the close and not yet filled it
+                if (ring_.drained()) { return; }
+
+                if (pending)
+                {
+                    flush();
+                    pending = false;
+                }
+
+                detail::back_off(polls);
+            }
+        }
+
+        // after a failure rows are still drained so producers never wait on a ring nobody empties
+        void write(const T & value)
+        {
+            if (error_ != nullptr) { return; }
+
+            try
+            {
+                file_.append(value);
+            }
+            catch (...)
+            {
+                error_ = std::current_exception();
+            }
+        }
+
+        void flush()
+        {
+            if (error_ != nullptr) { return; }
+
+            try
+            {
+                file_.flush();
+            }
+            catch (...)
+            {
+                error_ = std::current_exception();
+            }
+        }
+
+        detail::mpsc_ring<T> ring_;
+        std::exception_ptr error_;
+        csv_file_writer<T> file_;
+        // started last, once everything it uses is constructed
+        std::thread consumer_;
+    };
+
+    /// Thrown into the future of an asynchronous load or save whose cancellation_token was cancelled
+    class operation_cancelled final : public std::exception
+    {
+    public:
+        const char * what() const noexcept override { return "fastcsv operation cancelled"; }
+    };
+
+    /// Shared flag asking an asynchronous load or save to stop, copies refer to the same flag. The task checks it
+    /// before reading or writing the file, between reading a file and parsing it, and once per row, so cancelling
+    /// stops it within a row
+    class cancellation_token
+    {
+    public:
+        cancellation_token() : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+        void cancel() noexcept { cancelled_->store(true, std::memory_order_relaxed); }
+
+        FASTCSV_NO_DISCARD bool is_cancelled() const noexcept { return cancelled_->load(std::memory_order_relaxed); }
+
+        void throw_if_cancelled() const
+        {
+            if (is_cancelled()) { throw operation_cancelled(); }
+        }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> cancelled_;
+    };
+
+    /// Default executor of load_csv_async and save_csv_async, a tag asking them to run each task on a thread of its
+    /// own started through std::async, so destroying the returned future waits for the task. Any callable taking a
+    /// std::function<void()> can be passed instead to run the tasks on an existing pool or event loop
+    struct thread_executor
+    {
+    };
+
+    namespace detail
+    {
+
+        template <typename TExecutor>
+        inline constexpr bool is_thread_executor_v = std::is_same_v<std::remove_cv_t<TExecutor>, thread_executor>;
+
+        template <typename TExecutor>
+        inline constexpr bool is_executor_v
+            = is_thread_executor_v<TExecutor> || std::is_invocable_v<TExecutor &, std::function<void()>>;
+
+        // Hands work to the executor and returns the future of its result, the calling thread only pays for this. The
+        // thread_executor goes through std::async so no thread outlives its future
+        template <typename TResult, typename TExecutor, typename TWork>
+        FASTCSV_NO_DISCARD std::future<TResult> submit(TExecutor & executor, TWork work)
+        {
+            if constexpr (is_thread_executor_v<TExecutor>)
+            {
+                return std::async(std::launch::async, std::move(work));
+            }
+            else
+            {
+                auto promise = std::make_shared<std::promise<TResult>>();
+                auto future = promise->get_future();
+
+                executor(std::function<void()>([promise, work = std::move(work)]() mutable {
+                    try
+                    {
+                        if constexpr (std::is_void_v<TResult>)
+                        {
+                            work();
+                            promise->set_value();
+                        }
+                        else { promise->set_value(work()); }
+                    }
+                    catch (...)
+                    {
+                        promise->set_exception(std::current_exception());
+                    }
+                }));
+
+                return future;
+            }
+        }
+
+    }  // namespace detail
+
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter, typename TExecutor>
+        requires detail::is_executor_v<TExecutor>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        typename TExecutor,
+        std::enable_if_t<
+            detail::is_adapter_v<TAdapter, T, TIntermediate> && detail::is_executor_v<TExecutor>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::future<std::vector<T>> load_csv_async(
+        const std::filesystem::path & filePath,
+        TAdapter adapter,
+        cancellation_token token,
+        TExecutor executor,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return detail::submit<std::vector<T>>(executor, [filePath, adapter, token, noHeaderOption]() mutable {
+            token.throw_if_cancelled();
+
+            auto checked = [&adapter, &token](TIntermediate && value) -> decltype(auto) {
+                token.throw_if_cancelled();
+                return adapter(std::move(value));
+            };
+
+#if defined(FASTCSV_HAS_ZLIB)
+            // decompressed and parsed batch by batch, there is no point at which the whole file has been read
+            if (detail::is_gzip_csv(filePath))
+            {
+                return load_csv<T, TIntermediate, decltype(checked)>(filePath, checked, noHeaderOption);
+            }
+#endif
+
+            const auto content = detail::load_file(filePath);
+            token.throw_if_cancelled();
+            return read_csv<T, TIntermediate, decltype(checked)>(content, checked, noHeaderOption);
+        });
+    }
+
+    template <typename T, typename TExecutor, std::enable_if_t<detail::is_executor_v<TExecutor>> * = nullptr>
+    FASTCSV_NO_DISCARD std::future<std::vector<T>> load_csv_async(
+        const std::filesystem::path & filePath,
+        cancellation_token token,
+        TExecutor executor,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return load_csv_async<T, T, detail::identity, TExecutor>(
+            filePath, detail::identity{}, std::move(token), std::move(executor), noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::future<std::vector<T>> load_csv_async(
+        const std::filesystem::path & filePath,
+        cancellation_token token,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return load_csv_async<T>(filePath, std::move(token), thread_executor{}, noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::future<std::vector<T>> load_csv_async(
+        const std::filesystem::path & filePath, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return load_csv_async<T>(filePath, cancellation_token(), thread_executor{}, noHeaderOption);
+    }
+
+    /// Takes data by value so the task owns the rows, move them in to avoid the copy. A cancelled save removes the
+    /// partly written file
+#if defined(FASTCSV_HAS_CXX20)
+    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter, typename TExecutor>
+        requires detail::is_executor_v<TExecutor>
+#else
+    template <
+        typename T,
+        typename TIntermediate,
+        typename TAdapter,
+        typename TExecutor,
+        std::enable_if_t<
+            detail::is_adapter_v<TAdapter, TIntermediate, T> && detail::is_executor_v<TExecutor>> * = nullptr>
+#endif
+    FASTCSV_NO_DISCARD std::future<void> save_csv_async(
+        const std::filesystem::path & filePath,
+        std::vector<T> data,
+        TAdapter adapter,
+        cancellation_token token,
+        TExecutor executor,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return detail::submit<void>(
+            executor, [filePath, data = std::move(data), adapter, token, noHeaderOption]() mutable {
+                token.throw_if_cancelled();
+
+                auto checked = [&adapter, &token](const T & value) -> decltype(auto) {
+                    token.throw_if_cancelled();
+                    return adapter(value);
+                };
+
+                try
+                {
+                    save_csv<T, TIntermediate, decltype(checked)>(filePath, data, checked, noHeaderOption);
+                }
+                catch (const operation_cancelled &)
+                {
+                    std::filesystem::remove(filePath);
+                    throw;
+                }
+            });
+    }
+
+    template <typename T, typename TExecutor, std::enable_if_t<detail::is_executor_v<TExecutor>> * = nullptr>
+    FASTCSV_NO_DISCARD std::future<void> save_csv_async(
+        const std::filesystem::path & filePath,
+        std::vector<T> data,
+        cancellation_token token,
+        TExecutor executor,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return save_csv_async<T, T, detail::identity, TExecutor>(
+            filePath, std::move(data), detail::identity{}, std::move(token), std::move(executor), noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::future<void> save_csv_async(
+        const std::filesystem::path & filePath,
+        std::vector<T> data,
+        cancellation_token token,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return save_csv_async<T>(filePath, std::move(data), std::move(token), thread_executor{}, noHeaderOption);
+    }
+
+    template <typename T>
+    FASTCSV_NO_DISCARD std::future<void> save_csv_async(
+        const std::filesystem::path & filePath,
+        std::vector<T> data,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return save_csv_async<T>(filePath, std::move(data), cancellation_token(), thread_executor{}, noHeaderOption);
+    }
+
+
+    /// Reads each column into its own vector. Wrapping a column type in memoized<T> converts repeated values through a
+    /// memo_cache, memoStats receives one entry per column with the hit and miss counts of memoized columns
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD std::tuple<std::vector<detail::column_value_t<Ts>>...> read_csv_v(
+        const std::string & content,
+        std::vector<memo_stats> & memoStats,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        using result_type = std::tuple<std::vector<detail::column_value_t<Ts>>...>;
+
+        memoStats.assign(sizeof...(Ts), memo_stats{ 0ul, 0ul });
+        if (content.empty()) { return result_type(); }
+
+        auto parser = detail::csv_parser(
+            content,
+            detail::default_column_delimiter<char>,
+            detail::quote<char>,
+            detail::escape<char>);
+        parser.record_errors(policy != error_policy::throw_exception);
+
+        auto row = 0ul;
+        if (!noHeaderOption.has_value())
+        {
+            parser.advance_line();
+            ++row;
+        }
+
+        result_type data = [&]() {
+            // if (parser.current_element_size() != 0ul)
+            // {
+            //     // Simple heuristic to estimate the total number of lines to avoid lots of vector resizing
+            //     auto estimatedNumberOfLines = content.size() / parser.current_element_size();
+            //     return detail::make_reserved_vectors<Ts...>(estimatedNumberOfLines);
+            // }
+
+            return result_type();
+        }();
+
+        auto caches = std::tuple<detail::column_cache_t<Ts>...>();
+
+        auto size = 0ul;
+        while (!parser.end_of_file())
+        {
+            if (policy == error_policy::throw_exception)
+            {
+                try
+                {
+                    detail::read_line(parser, data, caches);
+                }
+                catch (const fastcsv_exception & exception)
+                {
+                    detail::throw_located(content, parser, exception);
+                }
+            }
+            else
+            {
+                try
+                {
+                    detail::read_line(parser, data, caches);
+                }
+                catch (...)
+                {
+                    detail::record_thrown_error(parser);
+                }
+
+                if (parser.has_error())
+                {
+                    // drop the columns already read from the failed row
+                    std::apply(
+                        [size](auto &... vectors) {
+                            (vectors.erase(vectors.begin() + static_cast<ptrdiff_t>(size), vectors.end()), ...);
+                        },
+                        data);
+
+                    if (!detail::record_row_error(parser, policy, row, errors)) { break; }
+                }
+                else
+                {
+                    ++size;
+                }
+            }
+
+            parser.advance_line();
+            ++row;
+        }
+
+        std::apply([&](const auto &... cache) { memoStats = { detail::column_stats(cache)... }; }, caches);
+
+        return data;
+    }
+
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD std::tuple<std::vector<detail::column_value_t<Ts>>...> read_csv_v(
+        const std::string & content,
+        std::vector<memo_stats> & memoStats,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto errors = std::vector<csv_error>();
+        return read_csv_v<Ts...>(content, memoStats, error_policy::throw_exception, errors, noHeaderOption);
+    }
+
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD std::tuple<std::vector<detail::column_value_t<Ts>>...> read_csv_v(
+        const std::string & content,
+        error_policy policy,
+        std::vector<csv_error> & errors,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto memoStats = std::vector<memo_stats>();
+        return read_csv_v<Ts...>(content, memoStats, policy, errors, noHeaderOption);
+    }
+
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD std::tuple<std::vector<detail::column_value_t<Ts>>...> read_csv_v(
+        const std::string & content, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto memoStats = std::vector<memo_stats>();
+        return read_csv_v<Ts...>(content, memoStats, noHeaderOption);
+    }
+
+    /// Checks the column count of every row, that quotes are balanced and that every field converts to its column
+    /// type without building any values. Large content is split into chunks validated in parallel, maxViolations
+    /// limits how many violations are kept while all of them are counted
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD csv_validation validate_csv(
+        std::string_view content,
+        size_t maxViolations,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        static constexpr auto validators = std::array<detail::field_validator, sizeof...(Ts)>{
+            &detail::validate_field<detail::column_value_t<Ts>>...
         };
+        static constexpr auto minimumChunkSize = size_t{ 1ul << 22 };
+
+        auto begin = 0ul;
+        if (!noHeaderOption.has_value())
+        {
+            auto parser = detail::csv_parser(content);
+            parser.advance_line();
+            begin = parser.line_start();
+        }
+
+        const auto threads = std::max(std::thread::hardware_concurrency(), 1u);
+        const auto chunkCount = std::clamp((content.size() - begin) / minimumChunkSize, size_t{ 1 }, size_t{ threads });
+
+        return detail::validate_chunks(
+            content,
+            begin,
+            noHeaderOption.has_value() ? 0ul : 1ul,
+            validators,
+            maxViolations,
+            chunkCount);
+    }
+
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD csv_validation validate_csv(
+        std::string_view content, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        return validate_csv<Ts...>(content, 100ul, noHeaderOption);
+    }
+
+    /// Infers the type and nullability of each column from up to sampleRows rows spread evenly through the content,
+    /// not just its head. Sampling jumps to byte offsets and starts at the next line, rows with a different number of
+    /// columns than the first are ignored since a jump may land inside a quoted field that spans lines
+    FASTCSV_NO_DISCARD inline csv_schema infer_schema(
+        std::string_view content,
+        size_t sampleRows = 1000ul,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    {
+        auto schema = csv_schema{ {}, 0ul };
+        if (content.empty()) { return schema; }
+
+        auto parser = detail::csv_parser(content);
+        do
+        {
+            auto name = !noHeaderOption.has_value() ? std::string(parser.current_column()) : std::string();
+            unescape_in_place(name);
+            schema.columns.push_back(column_schema{ std::move(name), column_type::string, false });
+        } while (parser.advance_column());
 
-    }  // namespace detail
+        if (noHeaderOption.has_value()) { parser.seek_line(0ul); }
+        else
+        {
+            parser.advance_line();
+        }
 
-    FASTCSV_CONSTEXPR inline detail::no_header_tag no_header{};
+        const auto columnCount = schema.columns.size();
+        const auto begin = parser.line_start();
+        auto types = std::vector<uint32_t>(columnCount, (detail::column_type_bit(column_type::string) << 1u) - 1u);
+        auto seen = std::vector<bool>(columnCount, false);
+        auto fields = std::vector<std::string_view>(columnCount);
 
-#if defined(FASTCSV_HAS_CXX20)
-    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter>
-#else
-    template <
-        typename T,
-        typename TIntermediate,
-        typename TAdapter,
-        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate>> * = nullptr>
-#endif
-    FASTCSV_NO_DISCARD std::vector<T> read_csv(
-        const std::string & content,
-        TAdapter adapter,
-        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+        auto next = begin;
+        for (auto i = 0ul; i < sampleRows && next < content.size(); ++i)
+        {
+            // start at the line after the target offset, or the line after the previous sample if that is further
+            const auto target = begin + (content.size() - begin) * i / sampleRows;
+            if (target > next)
+            {
+                const auto lineEnd = detail::find_first<char>(
+                    content.data() + target - 1ul,
+                    content.data() + content.size(),
+                    detail::new_line<char>);
+                next = static_cast<size_t>(lineEnd - content.data()) + 1ul;
+                if (next >= content.size()) { break; }
+            }
+
+            parser.seek_line(next);
+            auto column = 0ul;
+            do
+            {
+                if (column < columnCount) { fields[column] = parser.current_column(); }
+                ++column;
+            } while (parser.advance_column());
+
+            parser.advance_line();
+            next = parser.line_start();
+            if (column != columnCount) { continue; }
+
+            for (auto c = 0ul; c < columnCount; ++c)
+            {
+                if (detail::is_null_field(fields[c])) { schema.columns[c].nullable = true; }
+                else
+                {
+                    types[c] &= detail::classify_field(fields[c]);
+                    seen[c] = true;
+                }
+            }
+            ++schema.sampled_rows;
+        }
+
+        for (auto c = 0ul; c < columnCount; ++c)
+        {
+            schema.columns[c].type
+                = seen[c] ? static_cast<column_type>(detail::count_trailing_zeros(types[c])) : column_type::string;
+        }
+
+        return schema;
+    }
+
+    /// Columnar storage for content whose column types are only known at runtime. Each column is read into a vector
+    /// of its column_type: bool, int64_t, double, std::string, and under C++20 std::chrono::year_month_day for dates
+    /// and std::chrono::sys_time<std::chrono::nanoseconds> for timestamps, which are strings otherwise.
+    /// Empty fields and empty quoted strings are null in any column, they hold a default value and mark the column
+    /// nullable in schema()
+    class csv_table
     {
-        if (content.empty()) { return std::vector<T>(); }
+    public:
+        /// Reads with the given column types, names come from the header
+        csv_table(
+            std::string_view content,
+            const std::vector<column_type> & types,
+            std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+          : csv_table(content, make_schema(types), noHeaderOption)
+        {
+        }
 
-        auto parser = detail::csv_parser(
-            content,
-            detail::default_column_delimiter<char>,
-            detail::quote<char>,
-            detail::escape<char>);
+        /// Reads with a schema, typically from infer_schema. Columns without a name take it from the header
+        csv_table(
+            std::string_view content,
+            csv_schema schema,
+            std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+          : schema_(std::move(schema)), rows_(0ul)
+        {
+            read(content, noHeaderOption);
+        }
 
-        if (!noHeaderOption.has_value()) { parser.advance_line(); }
+        /// Infers the schema from a sample of the content before reading it
+        explicit csv_table(
+            std::string_view content, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+          : csv_table(content, infer_schema(content, 1000ul, noHeaderOption), noHeaderOption)
+        {
+        }
 
-        auto data = std::vector<T>();
-        // if (linesIterator.current_element_size() != 0ul)
-        // {
-        //     // Simple heuristic to estimate the total number of lines to avoid lots of vector resizing
-        //     auto estimatedNumberOfLines = content.size() / linesIterator.current_element_size();
-        //     data.reserve(estimatedNumberOfLines);
-        // }
+        FASTCSV_NO_DISCARD const csv_schema & schema() const noexcept { return schema_; }
 
-        while (!parser.end_of_file())
+        FASTCSV_NO_DISCARD size_t rows() const noexcept { return rows_; }
+
+        FASTCSV_NO_DISCARD size_t columns() const noexcept { return columns_.size(); }
+
+        FASTCSV_NO_DISCARD size_t column_index(std::string_view name) const
         {
-            data.emplace_back(adapter(from_csv<TIntermediate>{ parser }()));
-            parser.advance_line();
+            for (auto i = 0ul; i < schema_.columns.size(); ++i)
+            {
+                if (schema_.columns[i].name == name) { return i; }
+            }
+
+            throw fastcsv_exception(fmt::format("Unknown column '{}'  {} {}", name, __FILE__, __LINE__));
         }
 
-        return data;
+        /// Values of a column, T has to be the storage type of its column_type
+        template <typename T>
+        FASTCSV_NO_DISCARD const std::vector<T> & column(size_t index) const
+        {
+            if (index >= columns_.size())
+            {
+                throw fastcsv_exception(fmt::format("Column {} out of range  {} {}", index, __FILE__, __LINE__));
+            }
+
+            if (auto values = std::get_if<std::vector<T>>(&columns_[index])) { return *values; }
+
+            throw fastcsv_exception(fmt::format(
+                "Column '{}' is not stored as {}  {} {}",
+                schema_.columns[index].name,
+                typeid(T).name(),
+                __FILE__,
+                __LINE__));
+        }
+
+        template <typename T>
+        FASTCSV_NO_DISCARD const std::vector<T> & column(std::string_view name) const
+        {
+            return column<T>(column_index(name));
+        }
+
+        FASTCSV_NO_DISCARD bool is_null(size_t column, size_t row) const
+        {
+            const auto & nullRows = nullRows_.at(column);
+            return std::binary_search(nullRows.begin(), nullRows.end(), row);
+        }
+
+    private:
+        FASTCSV_NO_DISCARD static csv_schema make_schema(const std::vector<column_type> & types)
+        {
+            auto schema = csv_schema{ {}, 0ul };
+            for (auto type : types)
+            {
+                schema.columns.push_back(column_schema{ std::string(), type, false });
+            }
+            return schema;
+        }
+
+        void read(std::string_view content, std::optional<detail::no_header_tag> noHeaderOption)
+        {
+            const auto columnCount = schema_.columns.size();
+            nullRows_.resize(columnCount);
+            for (const auto & column : schema_.columns)
+            {
+                columns_.push_back(detail::make_table_column(column.type));
+            }
+
+            // the appenders point into columns_, which is not resized from here on
+            auto appenders = std::vector<detail::table_appender>();
+            for (auto & column : columns_)
+            {
+                appenders.push_back(detail::make_table_appender(column));
+            }
+
+            if (content.empty()) { return; }
+
+            auto parser = detail::csv_parser(content);
+            if (!noHeaderOption.has_value())
+            {
+                auto i = 0ul;
+                do
+                {
+                    if (i < columnCount && schema_.columns[i].name.empty())
+                    {
+                        schema_.columns[i].name = std::string(parser.current_column());
+                        unescape_in_place(schema_.columns[i].name);
+                    }
+                    ++i;
+                } while (parser.advance_column());
+
+                parser.advance_line();
+            }
+
+            try
+            {
+                while (!parser.end_of_file())
+                {
+                    for (auto i = 0ul; i < columnCount; ++i)
+                    {
+                        if (detail::is_null_field(parser.current_column()))
+                        {
+                            std::visit([](auto & values) { values.emplace_back(); }, columns_[i]);
+                            nullRows_[i].push_back(rows_);
+                            schema_.columns[i].nullable = true;
+                            parser.advance_column();
+                        }
+                        else
+                        {
+                            appenders[i].append(appenders[i].values, parser);
+                        }
+                    }
+
+                    parser.advance_line();
+                    ++rows_;
+                }
+            }
+            catch (const fastcsv_exception & exception)
+            {
+                detail::throw_located(content, parser, exception);
+            }
+        }
+
+        csv_schema schema_;
+        size_t rows_;
+        std::vector<detail::table_column> columns_;
+        // sorted row indices of the empty fields of each column
+        std::vector<std::vector<size_t>> nullRows_;
+    };
+
+    // ToDo: load_csv_v
+
+    template <typename... Ts>
+    void write_csv_v(
+        output_buffer & out, const std::vector<std::string_view> & headers, const std::vector<Ts> &... vectors)
+    {
+        if (!headers.empty())
+        {
+            auto first = true;
+            for (auto i = 0ul; i < std::min(headers.size(), sizeof...(Ts)); ++i)
+            {
+                if (!first) { out.push_back(detail::default_column_delimiter<char>); }
+                out.append(headers[i]);
+                first = false;
+            }
+            for (auto i = headers.size(); i < sizeof...(Ts); ++i)
+            {
+                out.push_back(detail::default_column_delimiter<char>);
+            }
+            out.append(detail::default_line_delimiter<char>);
+        }
+
+        constexpr auto columns = sizeof...(Ts);
+        const auto line = std::string_view(detail::default_line_delimiter<char>);
+        const auto minSize = std::min({ vectors.size()... });
+
+        // Each column is formatted on its own in blocks of rows, then the cells are copied into rows
+        auto cells = std::array<output_buffer, columns>();
+        auto ends = std::array<std::vector<size_t>, columns>();
+
+        for (auto first = 0ul; first < minSize; first += detail::column_block_rows)
+        {
+            const auto rows = std::min(detail::column_block_rows, minSize - first);
+
+            auto column = 0ul;
+            ((detail::format_column(cells[column], ends[column], vectors, first, first + rows), ++column), ...);
+
+            auto size = rows * (columns + line.size());
+            for (const auto & columnCells : cells)
+            {
+                size += columnCells.size();
+            }
+
+            auto dest = out.reserve(size);
+            for (auto row = 0ul; row < rows; ++row)
+            {
+                for (auto i = 0ul; i < columns; ++i)
+                {
+                    const auto begin = row == 0ul ? 0ul : ends[i][row - 1ul];
+                    const auto count = ends[i][row] - begin;
+                    std::char_traits<char>::copy(dest, cells[i].view().data() + begin, count);
+                    dest += count;
+                    *dest++ = detail::default_column_delimiter<char>;
+                }
+                std::char_traits<char>::copy(dest - 1, line.data(), line.size());
+                dest += line.size() - 1ul;
+            }
+            out.commit(dest);
+        }
     }
 
-    template <typename T>
-    FASTCSV_NO_DISCARD std::vector<T> read_csv(
-        const std::string & content, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+    template <typename... Ts>
+    void write_csv_v(
+        std::ostream & os, const std::vector<std::string_view> & headers, const std::vector<Ts> &... vectors)
     {
-        return read_csv<T, T, detail::identity>(content, detail::identity{}, noHeaderOption);
+        auto out = output_buffer(os);
+        write_csv_v<Ts...>(out, headers, vectors...);
+        out.flush();
+    }
+
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD std::string write_csv_v(const std::vector<Ts> &... vectors)
+    {
+        auto out = output_buffer();
+        write_csv_v<Ts...>(out, {}, vectors...);
+        return std::string(out.view());
+    }
+
+    template <typename... Ts>
+    FASTCSV_NO_DISCARD std::string write_csv_v(
+        const std::vector<std::string_view> & headers, const std::vector<Ts> &... vectors)
+    {
+        auto out = output_buffer();
+        write_csv_v<Ts...>(out, headers, vectors...);
+        return std::string(out.view());
+    }
+
+    template <typename... Ts>
+    void save_csv_v(const std::filesystem::path & filePath, const std::vector<Ts> &... vectors)
+    {
+        auto file = detail::open_csv_output(filePath);
+        write_csv_v<Ts...>(file, {}, vectors...);
+        detail::close_csv_output(file, filePath);
     }
 
+    template <typename... Ts>
+    void save_csv_v(
+        const std::filesystem::path & filePath,
+        const std::vector<std::string_view> & headers,
+        const std::vector<Ts> &... vectors)
+    {
+        auto file = detail::open_csv_output(filePath);
+        write_csv_v<Ts...>(file, headers, vectors...);
+        detail::close_csv_output(file, filePath);
+    }
+
+    /// True for types a snapshot stores as their bytes: arithmetic and enum types, chrono durations, time points and
+    /// dates, and decimal. Specialise it for trivially copyable row types of your own whose members are all such
+    /// types, never for types holding pointers or views whose targets would not survive the process
+    template <typename T, typename = void>
+    struct csv_snapshot_copyable : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T>>
+    {
+    };
+
+    template <typename Rep, typename Period>
+    struct csv_snapshot_copyable<std::chrono::duration<Rep, Period>> : std::true_type
+    {
+    };
+
+    template <typename Clock, typename Duration>
+    struct csv_snapshot_copyable<std::chrono::time_point<Clock, Duration>> : std::true_type
+    {
+    };
+
+    template <unsigned Scale, typename Rep>
+    struct csv_snapshot_copyable<decimal<Scale, Rep>> : std::true_type
+    {
+    };
+
 #if defined(FASTCSV_HAS_CXX20)
-    template <typename T, typename TIntermediate, detail::adapter<T, TIntermediate> TAdapter>
-#else
-    template <
-        typename T,
-        typename TIntermediate,
-        typename TAdapter,
-        std::enable_if_t<detail::is_adapter_v<TAdapter, T, TIntermediate>> * = nullptr>
+    template <>
+    struct csv_snapshot_copyable<std::chrono::year_month_day> : std::true_type
+    {
+    };
 #endif
-    FASTCSV_NO_DISCARD std::vector<T> load_csv(
-        const std::filesystem::path & filePath,
-        TAdapter adapter,
-        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
+
+    template <typename T>
+    inline constexpr bool csv_snapshot_copyable_v = csv_snapshot_copyable<T>::value;
+
+    namespace detail
     {
-        if (!std::filesystem::exists(filePath) || !std::filesystem::is_regular_file(filePath))
+
+        // Word at a time hash, cheap enough to run over a whole source file to tell whether it changed
+        FASTCSV_NO_DISCARD inline uint64_t hash_bytes(std::string_view bytes, uint64_t seed = 0x243F6A8885A308D3ull)
+        {
+            constexpr auto multiplier = 0x9E3779B97F4A7C15ull;
+
+            auto hash = seed ^ (bytes.size() * multiplier);
+            auto first = bytes.data();
+            const auto last = first + bytes.size();
+            for (; last - first >= 8; first += 8)
+            {
+                auto word = uint64_t{ 0ull };
+                std::memcpy(&word, first, sizeof(word));
+                hash = (hash ^ word) * multiplier;
+                hash ^= hash >> 32;
+            }
+            for (; first != last; ++first)
+            {
+                hash = (hash ^ static_cast<unsigned char>(*first)) * multiplier;
+                hash ^= hash >> 32;
+            }
+            return hash;
+        }
+
+        // Names T through the compiler's function signature, so snapshots can tell column types apart without RTTI
+        template <typename T>
+        FASTCSV_NO_DISCARD std::string_view type_signature() noexcept
+        {
+#if defined(FASTCSV_COMPILER_MSVC)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        // Read only view of a whole file, memory mapped where the platform allows
+        class mapped_file
+        {
+        public:
+            explicit mapped_file(const std::filesystem::path & filePath)
+            {
+#if defined(FASTCSV_PLATFORM_LINUX)
+                const auto fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0) { throw_errno("open", filePath.string()); }
+
+                size_ = static_cast<size_t>(std::filesystem::file_size(filePath));
+                if (size_ != 0ul)
+                {
+                    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (data_ == MAP_FAILED)
+                    {
+                        data_ = nullptr;
+                        ::close(fd);
+                        throw_errno("map", filePath.string());
+                    }
+                }
+                ::close(fd);
+#else
+                auto file = std::ifstream(filePath, std::ios::in | std::ios::binary);
+                if (!file)
+                {
+                    throw fastcsv_exception(
+                        fmt::format("Cannot open file: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+                }
+                content_.resize(static_cast<size_t>(std::filesystem::file_size(filePath)));
+                file.read(content_.data(), static_cast<std::streamsize>(content_.size()));
+#endif
+            }
+
+            mapped_file(const mapped_file &) = delete;
+            mapped_file & operator=(const mapped_file &) = delete;
+
+            ~mapped_file()
+            {
+#if defined(FASTCSV_PLATFORM_LINUX)
+                if (data_ != nullptr) { ::munmap(data_, size_); }
+#endif
+            }
+
+            FASTCSV_NO_DISCARD std::string_view view() const noexcept
+            {
+#if defined(FASTCSV_PLATFORM_LINUX)
+                return std::string_view(static_cast<const char *>(data_), size_);
+#else
+                return content_;
+#endif
+            }
+
+        private:
+#if defined(FASTCSV_PLATFORM_LINUX)
+            void * data_ = nullptr;
+            size_t size_ = 0ul;
+#else
+            std::string content_;
+#endif
+        };
+
+        inline constexpr char snapshot_magic[8] = { 'F', 'C', 'S', 'V', 'S', 'N', 'A', 'P' };
+        inline constexpr uint32_t snapshot_version = 1u;
+        // written in host byte order, so a snapshot from a machine of the other endianness reads back differently
+        inline constexpr uint32_t snapshot_byte_order = 0x01020304u;
+        // column data starts on cache line boundaries
+        inline constexpr size_t snapshot_alignment = 64ul;
+
+        // The csv file a snapshot was made from, zero when it was saved directly
+        struct snapshot_source
         {
-            throw fastcsv_exception(fmt::format("File does not exist: '{}'  {} {}", filePath, __FILE__, __LINE__));
-        }
+            uint64_t size;
+            int64_t modified;
+            uint64_t hash;
+        };
 
-        if (filePath.extension() != detail::csv_extension<char>)
+        struct snapshot_header
         {
-            throw fastcsv_exception(fmt::format(
-                "File does not have the required '.{}' extension: {}  {} {}",
-                detail::csv_extension<char>,
-                __FILE__,
-                __LINE__));
-        }
+            char magic[8];
+            uint32_t version;
+            uint32_t byte_order;
+            uint64_t columns;
+            uint64_t rows;
+            snapshot_source source;
+        };
 
-        // ToDo: use memory mapped files
-        auto file = std::ifstream(filePath, std::ios::in | std::ios::binary);
+        enum class snapshot_kind : uint32_t
+        {
+            // rows of a trivially copyable type stored back to back
+            fixed = 0u,
+            // the end offset of each string followed by their characters
+            text = 1u
+        };
 
-        if (!file)
+        struct snapshot_column
         {
-            throw fastcsv_exception(fmt::format("Cannot open file: {}  {} {}", filePath, __FILE__, __LINE__));
-        }
+            uint64_t type;
+            snapshot_kind kind;
+            uint32_t element_size;
+            uint64_t offset;
+            uint64_t size;
+            uint64_t text_offset;
+            uint64_t text_size;
+        };
 
-        std::string content;
-        content.resize(static_cast<size_t>(std::filesystem::file_size(filePath)));
-        file.read(content.data(), content.size());
+        template <typename T>
+        inline constexpr bool is_snapshot_column_v
+            = std::is_same_v<T, std::string> || (csv_snapshot_copyable_v<T> && std::is_trivially_copyable_v<T>);
 
-        if (!file)
+        // Names a temporary file next to filePath that no other process, thread or call shares
+        FASTCSV_NO_DISCARD inline std::filesystem::path temporary_path(const std::filesystem::path & filePath)
         {
-            throw fastcsv_exception(
-                fmt::format("Could not read full contents of file: {}  {} {}", filePath, __FILE__, __LINE__));
+#if defined(FASTCSV_PLATFORM_LINUX)
+            static const auto process = static_cast<uint64_t>(::getpid());
+#else
+            static const auto process = static_cast<uint64_t>(std::random_device()());
+#endif
+            static auto calls = std::atomic<uint64_t>(0ull);
+
+            auto result = filePath;
+            result += fmt::format(
+                ".{:x}.{:x}.{:x}.tmp",
+                process,
+                std::hash<std::thread::id>()(std::this_thread::get_id()),
+                calls.fetch_add(1ull, std::memory_order_relaxed));
+            return result;
         }
 
-        return read_csv<T, TIntermediate, TAdapter>(content, adapter, noHeaderOption);
-    }
-
-    template <typename T>
-    FASTCSV_NO_DISCARD std::vector<T> load_csv(
-        const std::filesystem::path & filePath, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
-    {
-        return load_csv<T, T, detail::identity>(filePath, detail::identity{}, noHeaderOption);
-    }
-
+        FASTCSV_NO_DISCARD inline uint64_t snapshot_align(uint64_t offset) noexcept
+        {
+            return (offset + snapshot_alignment - 1ul) / snapshot_alignment * snapshot_alignment;
+        }
 
-#if defined(FASTCSV_HAS_CXX20)
-    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
-#else
-    template <
-        typename T,
-        typename TIntermediate,
-        typename TAdapter,
-        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
-#endif
-    void write_csv(
-        std::ostream & os,
-        const std::vector<T> & data,
-        TAdapter adapter,
-        std::optional<detail::no_header_tag> noHeader = std::nullopt)
-    {
-        if constexpr (has_csv_headers<TIntermediate>)
+        template <typename T>
+        FASTCSV_NO_DISCARD snapshot_column describe_snapshot_column(const std::vector<T> & values, uint64_t & offset)
         {
-            if (!noHeader.has_value())
+            auto column = snapshot_column{ hash_bytes(type_signature<T>()),
+                                           snapshot_kind::fixed,
+                                           static_cast<uint32_t>(sizeof(T)),
+                                           snapshot_align(offset),
+                                           0ull,
+                                           0ull,
+                                           0ull };
+            if constexpr (std::is_same_v<T, std::string>)
             {
-                auto first = true;
-                auto headers = csv_headers<TIntermediate>{}();
-                for (auto header : headers)
+                column.kind = snapshot_kind::text;
+                column.element_size = static_cast<uint32_t>(sizeof(uint64_t));
+                column.size = values.size() * sizeof(uint64_t);
+                column.text_offset = column.offset + column.size;
+                for (const auto & value : values)
                 {
-                    if (!first) { os << detail::default_column_delimiter<char>; }
-                    os << header;
-                    first = false;
+                    column.text_size += value.size();
                 }
-                os << detail::default_line_delimiter<char>;
+                offset = column.text_offset + column.text_size;
+            }
+            else
+            {
+                column.size = values.size() * sizeof(T);
+                offset = column.offset + column.size;
             }
+            return column;
         }
 
-        auto writer = to_csv<TIntermediate>{ os, true };
-
-        for (const auto & value : data)
+        template <typename T>
+        void write_snapshot_column(std::ofstream & file, const std::vector<T> & values, const snapshot_column & column)
         {
-            writer.first = true;
-            writer.write(adapter(value));
-            os << detail::default_line_delimiter<char>;
-        }
-    }
-
-    template <typename T>
-    void write_csv(
-        std::ostream & os,
-        const std::vector<T> & data,
-        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
-    {
-        write_csv<T, T, detail::identity>(os, data, detail::identity{}, noHeaderOption);
-    }
-
-#if defined(FASTCSV_HAS_CXX20)
-    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
-#else
-    template <
-        typename T,
-        typename TIntermediate,
-        typename TAdapter,
-        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
-#endif
-    FASTCSV_NO_DISCARD std::string write_csv(
-        const std::vector<T> & data,
-        TAdapter adapter,
-        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
-    {
-        std::stringstream stream;
-        write_csv<T, TIntermediate, TAdapter>(stream, data, adapter, noHeaderOption);
-        return stream.str();
-    }
+            constexpr char padding[snapshot_alignment] = {};
+            const auto position = static_cast<uint64_t>(file.tellp());
+            file.write(padding, static_cast<std::streamsize>(column.offset - position));
 
-    template <typename T>
-    FASTCSV_NO_DISCARD std::string write_csv(
-        const std::vector<T> & data, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
-    {
-        return write_csv<T, T, detail::identity>(data, detail::identity{}, noHeaderOption);
-    }
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+                auto ends = std::vector<uint64_t>();
+                ends.reserve(values.size());
+                auto end = uint64_t{ 0ull };
+                for (const auto & value : values)
+                {
+                    ends.push_back(end += value.size());
+                }
+                file.write(reinterpret_cast<const char *>(ends.data()), static_cast<std::streamsize>(column.size));
+                for (const auto & value : values)
+                {
+                    file.write(value.data(), static_cast<std::streamsize>(value.size()));
+                }
+            }
+            else
+            {
+                file.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(column.size));
+            }
+        }
 
-#if defined(FASTCSV_HAS_CXX20)
-    template <typename T, typename TIntermediate, detail::adapter<TIntermediate, T> TAdapter>
-#else
-    template <
-        typename T,
-        typename TIntermediate,
-        typename TAdapter,
-        std::enable_if_t<detail::is_adapter_v<TAdapter, TIntermediate, T>> * = nullptr>
-#endif
-    void save_csv(
-        const std::filesystem::path & filePath,
-        const std::vector<T> & data,
-        TAdapter adapter,
-        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
-    {
-        if (filePath.extension() != detail::csv_extension<char>)
+        // Writes to a temporary file renamed over filePath, so readers never see a partly written snapshot
+        template <typename... Ts>
+        void save_snapshot(
+            const std::filesystem::path & filePath, const snapshot_source & source, const std::vector<Ts> &... columns)
         {
-            throw fastcsv_exception(fmt::format(
-                "File does not have the required '.{}' extension: {}  {} {}",
-                detail::csv_extension<char>,
-                __FILE__,
-                __LINE__));
-        }
+            static_assert(sizeof...(Ts) != 0ul, "A snapshot has at least one column");
+            static_assert(
+                (is_snapshot_column_v<Ts> && ...),
+                "Snapshot columns are std::string or trivially copyable types marked csv_snapshot_copyable");
 
-        auto file = std::ofstream(filePath, std::ios::out | std::ios::binary);
-        write_csv<T, TIntermediate, TAdapter>(file, data, adapter, noHeaderOption);
-    }
+            const auto rows = std::min({ columns.size()... });
+            if (((columns.size() != rows) || ...))
+            {
+                throw fastcsv_exception(fmt::format(
+                    "Snapshot columns have different sizes: {}  {} {}", filePath.string(), __FILE__, __LINE__));
+            }
 
-    template <typename T>
-    void save_csv(
-        const std::filesystem::path & filePath,
-        const std::vector<T> & data,
-        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
-    {
-        save_csv<T, T, detail::identity>(filePath, data, detail::identity{}, noHeaderOption);
-    }
+            auto header = snapshot_header{ {}, snapshot_version, snapshot_byte_order, sizeof...(Ts), rows, source };
+            std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
 
+            auto offset = uint64_t{ sizeof(snapshot_header) + sizeof...(Ts) * sizeof(snapshot_column) };
+            const auto descriptors
+                = std::array<snapshot_column, sizeof...(Ts)>{ describe_snapshot_column(columns, offset)... };
 
-    template <typename... Ts>
-    FASTCSV_NO_DISCARD std::tuple<std::vector<Ts>...> read_csv_v(
-        const std::string & content, std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
-    {
-        if (content.empty()) { return std::tuple<std::vector<Ts>...>(); }
+            const auto temporary = temporary_path(filePath);
+            try
+            {
+                auto file = std::ofstream(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+                if (!file)
+                {
+                    throw fastcsv_exception(fmt::format(
+                        "Could not open file for writing: {}  {} {}", temporary.string(), __FILE__, __LINE__));
+                }
 
-        auto parser = detail::csv_parser(
-            content,
-            detail::default_column_delimiter<char>,
-            detail::quote<char>,
-            detail::escape<char>);
-        if (!noHeaderOption.has_value()) { parser.advance_line(); }
+                file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                file.write(
+                    reinterpret_cast<const char *>(descriptors.data()),
+                    static_cast<std::streamsize>(descriptors.size() * sizeof(snapshot_column)));
 
-        std::tuple<std::vector<Ts>...> data = [&]() {
-            // if (parser.current_element_size() != 0ul)
-            // {
-            //     // Simple heuristic to estimate the total number of lines to avoid lots of vector resizing
-            //     auto estimatedNumberOfLines = content.size() / parser.current_element_size();
-            //     return detail::make_reserved_vectors<Ts...>(estimatedNumberOfLines);
-            // }
+                auto index = 0ul;
+                (write_snapshot_column(file, columns, descriptors[index++]), ...);
 
-            return std::tuple<std::vector<Ts>...>();
-        }();
+                if (!file.flush())
+                {
+                    throw fastcsv_exception(
+                        fmt::format("Failed to write snapshot: {}  {} {}", temporary.string(), __FILE__, __LINE__));
+                }
+                file.close();
+                std::filesystem::rename(temporary, filePath);
+            }
+            catch (...)
+            {
+                auto error = std::error_code();
+                std::filesystem::remove(temporary, error);
+                throw;
+            }
+        }
 
-        while (!parser.end_of_file())
+        // Header and column descriptors of a mapped snapshot, nullopt when it is not a snapshot of Ts...
+        template <typename... Ts>
+        FASTCSV_NO_DISCARD std::optional<std::pair<snapshot_header, std::array<snapshot_column, sizeof...(Ts)>>>
+            check_snapshot(std::string_view bytes)
         {
-            detail::read_line<0ul, Ts...>(parser, data);
-            parser.advance_line();
-        }
+            auto header = snapshot_header();
+            auto descriptors = std::array<snapshot_column, sizeof...(Ts)>();
+            const auto descriptorsSize = sizeof...(Ts) * sizeof(snapshot_column);
+            if (bytes.size() < sizeof(header) + descriptorsSize) { return std::nullopt; }
+
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            if (std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0
+                || header.version != snapshot_version || header.byte_order != snapshot_byte_order
+                || header.columns != sizeof...(Ts))
+            {
+                return std::nullopt;
+            }
 
-        return data;
-    }
+            if constexpr (sizeof...(Ts) != 0ul)
+            {
+                std::memcpy(descriptors.data(), bytes.data() + sizeof(header), descriptorsSize);
+            }
 
-    // ToDo: load_csv_v
+            const auto types = std::array<uint64_t, sizeof...(Ts)>{ hash_bytes(type_signature<Ts>())... };
+            const auto sizes = std::array<uint64_t, sizeof...(Ts)>{
+                (std::is_same_v<Ts, std::string> ? sizeof(uint64_t) : sizeof(Ts))...
+            };
+            for (auto i = 0ul; i < sizeof...(Ts); ++i)
+            {
+                const auto & column = descriptors[i];
+                // rows is checked against the file before the multiplication so a corrupt count cannot wrap it
+                if (column.type != types[i] || column.element_size != sizes[i]
+                    || header.rows > bytes.size() / column.element_size
+                    || column.size != header.rows * column.element_size || column.offset > bytes.size()
+                    || column.size > bytes.size() - column.offset || column.text_offset > bytes.size()
+                    || column.text_size > bytes.size() - column.text_offset)
+                {
+                    return std::nullopt;
+                }
+            }
 
-    template <typename... Ts>
-    void write_csv_v(
-        std::ostream & os, const std::vector<std::string_view> & headers, const std::vector<Ts> &... vectors)
-    {
-        if (!headers.empty())
+            return std::make_pair(header, descriptors);
+        }
+
+        template <typename T>
+        FASTCSV_NO_DISCARD std::vector<T> read_snapshot_column(
+            std::string_view bytes, const snapshot_column & column, size_t rows)
         {
-            auto first = true;
-            for (auto i = 0ul; i < std::min(headers.size(), sizeof...(Ts)); ++i)
+            if constexpr (std::is_same_v<T, std::string>)
             {
-                if (!first) { os << detail::default_column_delimiter<char>; }
-                os << headers[i];
-                first = false;
+                auto ends = std::vector<uint64_t>(rows);
+                std::memcpy(ends.data(), bytes.data() + column.offset, column.size);
+
+                const auto text = bytes.substr(column.text_offset, column.text_size);
+                auto values = std::vector<std::string>();
+                values.reserve(rows);
+                auto begin = uint64_t{ 0ull };
+                for (const auto end : ends)
+                {
+                    if (end < begin || end > text.size())
+                    {
+                        throw fastcsv_exception(
+                            fmt::format("Corrupt snapshot string column  {} {}", __FILE__, __LINE__));
+                    }
+                    values.emplace_back(text.substr(begin, end - begin));
+                    begin = end;
+                }
+                return values;
             }
-            for (auto i = headers.size(); i < sizeof...(Ts); ++i)
+            else
             {
-                os << detail::default_column_delimiter<char>;
+                auto values = std::vector<T>(rows);
+                if (rows != 0ul) { std::memcpy(values.data(), bytes.data() + column.offset, column.size); }
+                return values;
             }
-            os << detail::default_line_delimiter<char>;
         }
 
-        // fold to get the minimal vector size: https://www.foonathan.net/2020/05/fold-tricks/
-        auto minSize = (vectors, ...).size();
-        ((vectors.size() < minSize ? minSize, 0ul : 0ul), ...);
+        template <typename... Ts, size_t... Is>
+        FASTCSV_NO_DISCARD std::tuple<std::vector<Ts>...> read_snapshot_columns(
+            std::string_view bytes,
+            const std::array<snapshot_column, sizeof...(Ts)> & descriptors,
+            size_t rows,
+            std::index_sequence<Is...>)
+        {
+            return std::tuple<std::vector<Ts>...>(read_snapshot_column<Ts>(bytes, descriptors[Is], rows)...);
+        }
 
-        for (auto i = 0ul; i < minSize; ++i)
+        template <typename... Ts>
+        FASTCSV_NO_DISCARD std::tuple<std::vector<Ts>...> load_snapshot(const std::filesystem::path & filePath)
         {
-            auto first = true;
-            (detail::write_line(os, vectors, i, first), ...);
-            os << detail::default_line_delimiter<char>;
+            static_assert(
+                (is_snapshot_column_v<Ts> && ...),
+                "Snapshot columns are std::string or trivially copyable types marked csv_snapshot_copyable");
+
+            const auto file = mapped_file(filePath);
+            const auto snapshot = check_snapshot<Ts...>(file.view());
+            if (!snapshot.has_value())
+            {
+                throw fastcsv_exception(fmt::format(
+                    "Not a version {} snapshot of these column types: {}  {} {}",
+                    snapshot_version,
+                    filePath.string(),
+                    __FILE__,
+                    __LINE__));
+            }
+
+            return read_snapshot_columns<Ts...>(
+                file.view(),
+                snapshot->second,
+                static_cast<size_t>(snapshot->first.rows),
+                std::index_sequence_for<Ts...>());
         }
-    }
 
+    }  // namespace detail
+
+    /// Saves columns, e.g. the result of read_csv_v, as a binary snapshot that load_snapshot_v maps back without any
+    /// parsing. Columns are std::string or csv_snapshot_copyable types, the file is only readable by the same build
     template <typename... Ts>
-    FASTCSV_NO_DISCARD std::string write_csv_v(const std::vector<Ts> &... vectors)
+    void save_snapshot_v(const std::filesystem::path & filePath, const std::vector<Ts> &... columns)
     {
-        std::stringstream stream;
-        write_csv_v<Ts...>(stream, {}, vectors...);
-        return stream.str();
+        detail::save_snapshot(filePath, detail::snapshot_source{ 0ull, 0ll, 0ull }, columns...);
     }
 
     template <typename... Ts>
-    FASTCSV_NO_DISCARD std::string write_csv_v(
-        const std::vector<std::string_view> & headers, const std::vector<Ts> &... vectors)
+    FASTCSV_NO_DISCARD std::tuple<std::vector<Ts>...> load_snapshot_v(const std::filesystem::path & filePath)
     {
-        std::stringstream stream;
-        write_csv_v<Ts...>(stream, headers, vectors...);
-        return stream.str();
+        return detail::load_snapshot<Ts...>(filePath);
     }
 
-    template <typename... Ts>
-    void save_csv_v(const std::filesystem::path & filePath, const std::vector<Ts> &... vectors)
+    /// Saves the rows of a csv_snapshot_copyable T as a binary snapshot that load_snapshot maps back without parsing
+    template <typename T>
+    void save_snapshot(const std::filesystem::path & filePath, const std::vector<T> & data)
     {
-        if (filePath.extension() != detail::csv_extension<char>)
-        {
-            throw fastcsv_exception(fmt::format(
-                "File does not have the required '.{}' extension: {}  {} {}",
-                detail::csv_extension<char>,
-                __FILE__,
-                __LINE__));
-        }
+        save_snapshot_v(filePath, data);
+    }
 
-        auto file = std::ofstream(filePath, std::ios::out | std::ios::binary);
-        write_csv_v<Ts...>(file, {}, vectors...);
+    template <typename T>
+    FASTCSV_NO_DISCARD std::vector<T> load_snapshot(const std::filesystem::path & filePath)
+    {
+        return std::get<0>(detail::load_snapshot<T>(filePath));
     }
 
-    template <typename... Ts>
-    void save_csv_v(
+    /// Loads a csv file through a snapshot kept in cacheDir. The snapshot is reused while the size, modification time
+    /// and content hash of the file match the ones it was made from, otherwise the file is parsed and the snapshot
+    /// rewritten. The file is only hashed once its size and modification time match, and only read into memory when
+    /// it has to be parsed. Rows are kept as they are in memory, so T has to be csv_snapshot_copyable
+    template <typename T>
+    FASTCSV_NO_DISCARD std::vector<T> load_csv(
         const std::filesystem::path & filePath,
-        const std::vector<std::string_view> & headers,
-        const std::vector<Ts> &... vectors)
+        const std::filesystem::path & cacheDir,
+        std::optional<detail::no_header_tag> noHeaderOption = std::nullopt)
     {
-        if (filePath.extension() != detail::csv_extension<char>)
+        static_assert(
+            detail::is_snapshot_column_v<T> && !std::is_same_v<T, std::string>,
+            "Cached rows have to be csv_snapshot_copyable");
+
+        if (!std::filesystem::is_regular_file(filePath))
         {
-            throw fastcsv_exception(fmt::format(
-                "File does not have the required '.{}' extension: {}  {} {}",
-                detail::csv_extension<char>,
-                __FILE__,
-                __LINE__));
+            throw fastcsv_exception(
+                fmt::format("File does not exist: '{}'  {} {}", filePath.string(), __FILE__, __LINE__));
         }
 
-        auto file = std::ofstream(filePath, std::ios::out | std::ios::binary);
-        write_csv_v<Ts...>(file, headers, vectors...);
+        // stated before the file is read, so a change made while loading leaves a snapshot that will not match
+        auto source = detail::snapshot_source{
+            static_cast<uint64_t>(std::filesystem::file_size(filePath)),
+            static_cast<int64_t>(std::filesystem::last_write_time(filePath).time_since_epoch().count()),
+            0ull,
+        };
+
+        // one snapshot per source path and header option
+        const auto key = detail::hash_bytes(
+            std::filesystem::absolute(filePath).string(), noHeaderOption.has_value() ? 1ull : 0ull);
+        const auto snapshotPath = cacheDir / fmt::format("{}.{:016x}.snapshot", filePath.filename().string(), key);
+
+        if (std::filesystem::is_regular_file(snapshotPath))
+        {
+            const auto file = detail::mapped_file(snapshotPath);
+            const auto snapshot = detail::check_snapshot<T>(file.view());
+            if (snapshot.has_value() && snapshot->first.source.size == source.size
+                && snapshot->first.source.modified == source.modified
+                && snapshot->first.source.hash == detail::hash_bytes(detail::mapped_file(filePath).view()))
+            {
+                return detail::read_snapshot_column<T>(
+                    file.view(), snapshot->second[0], static_cast<size_t>(snapshot->first.rows));
+            }
+        }
+
+        // a gzip file is fingerprinted by its compressed bytes, mapped rather than read as they are inflated apart
+        auto data = std::vector<T>();
+        if (detail::is_gzip_csv(filePath))
+        {
+            source.hash = detail::hash_bytes(detail::mapped_file(filePath).view());
+            data = load_csv<T>(filePath, noHeaderOption);
+        }
+        else
+        {
+            const auto content = detail::load_file(filePath);
+            source.hash = detail::hash_bytes(content);
+            data = read_csv<T>(content, noHeaderOption);
+        }
+
+        std::filesystem::create_directories(cacheDir);
+        detail::save_snapshot(snapshotPath, source, data);
+        return data;
     }
 
 }  // namespace fastcsv
\ No newline at end of file
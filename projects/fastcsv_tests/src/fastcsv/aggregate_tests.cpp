@@ -0,0 +1,166 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+    namespace
+    {
+        struct ticker
+        {
+            std::string symbol;
+            double price;
+            int quantity;
+
+            bool operator==(const ticker & other) const = default;
+        };
+
+        struct order
+        {
+            int64_t id;
+            ticker top;
+            std::optional<std::string> note;
+
+            bool operator==(const order & other) const = default;
+        };
+
+        struct unreadable
+        {
+            int id;
+            std::vector<int> values;
+        };
+
+        struct with_base : ticker
+        {
+            int64_t id;
+        };
+
+        struct keyed
+        {
+            int64_t id;
+        };
+
+        // as many initializers as members, the base takes the first
+        struct with_small_base : keyed
+        {
+            double price;
+        };
+
+        struct with_empty_base : std::tuple<>
+        {
+            int64_t id;
+            double price;
+        };
+
+        struct with_array
+        {
+            int id;
+            double levels[2];
+        };
+
+        struct wide
+        {
+            int a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15;
+            int b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15;
+            int c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15;
+            int d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10, d11, d12, d13, d14, d15;
+        };
+    }  // namespace
+
+    TEST(aggregate_tests, arity)
+    {
+        EXPECT_EQ(detail::aggregate_arity_v<ticker>, 3ul);
+        EXPECT_EQ(detail::aggregate_arity_v<order>, 3ul);
+        EXPECT_EQ(detail::aggregate_arity_v<wide>, 64ul);
+    }
+
+    TEST(aggregate_tests, traits)
+    {
+        EXPECT_TRUE(has_from_csv<ticker>);
+        EXPECT_TRUE(has_to_csv<order>);
+
+        EXPECT_FALSE(has_from_csv<unreadable>);
+        EXPECT_FALSE(has_to_csv<unreadable>);
+    }
+
+    TEST(aggregate_tests, bases_and_arrays_are_not_mapped)
+    {
+        EXPECT_FALSE(detail::is_member_wise_aggregate_v<with_base>);
+        EXPECT_FALSE(detail::is_member_wise_aggregate_v<with_small_base>);
+        EXPECT_FALSE(detail::is_member_wise_aggregate_v<with_empty_base>);
+        EXPECT_FALSE(detail::is_member_wise_aggregate_v<with_array>);
+        EXPECT_TRUE(detail::is_member_wise_aggregate_v<order>);
+        EXPECT_TRUE(detail::is_member_wise_aggregate_v<wide>);
+
+        EXPECT_FALSE(has_from_csv<with_base>);
+        EXPECT_FALSE(has_to_csv<with_base>);
+        EXPECT_FALSE(has_from_csv<with_small_base>);
+        EXPECT_FALSE(has_from_csv<with_empty_base>);
+        EXPECT_FALSE(has_to_csv<with_empty_base>);
+        EXPECT_FALSE(has_from_csv<with_array>);
+        EXPECT_FALSE(has_to_csv<with_array>);
+    }
+
+    TEST(aggregate_tests, read)
+    {
+        // Arrange
+        auto str = "symbol,price,quantity\n\"AAPL\",1.5,100\n\"MSFT\",2.25,-3\n"s;
+        auto expected = std::vector<ticker>{ { "AAPL", 1.5, 100 }, { "MSFT", 2.25, -3 } };
+
+        // Act
+        auto result = read_csv<ticker>(str);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(aggregate_tests, write_nested)
+    {
+        // Arrange
+        auto data = std::vector<order>{ { 1, { "AAPL", 1.5, 100 }, "first" },
+                                        { 2, { "MSFT", 2.25, -3 }, std::nullopt } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "1,AAPL,1.5,100,first\r\n2,MSFT,2.25,-3,\r\n"s;
+#else
+        auto expected = "1,AAPL,1.5,100,first\n2,MSFT,2.25,-3,\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(aggregate_tests, round_trip_wide)
+    {
+        // Arrange
+        auto expected = std::vector<wide>(3);
+        for (auto i = 0ul; i < expected.size(); ++i)
+        {
+            auto & row = expected[i];
+            row.a0 = static_cast<int>(i);
+            row.b7 = static_cast<int>(i) * 10;
+            row.d15 = -static_cast<int>(i);
+        }
+
+        // Act
+        auto csvString = write_csv(expected);
+        auto result = read_csv<wide>(csvString, no_header);
+
+        // Assert
+        ASSERT_EQ(result.size(), expected.size());
+        for (auto i = 0ul; i < result.size(); ++i)
+        {
+            EXPECT_EQ(result[i].a0, expected[i].a0);
+            EXPECT_EQ(result[i].b7, expected[i].b7);
+            EXPECT_EQ(result[i].d15, expected[i].d15);
+        }
+    }
+
+}  // namespace fastcsv::tests
@@ -101,7 +101,7 @@ namespace fastcsv::tests
             18446744072705551615ull,  // unsigned long long
             3.1415927f,               // float
             2.718281828459045,        // double
-            2.718281828459045         // long double
+            2.718281828459045l        // long double
         } };
 
         // Act
@@ -134,7 +134,7 @@ namespace fastcsv::tests
             18446744072705551615ull,  // unsigned long long
             3.1415927f,               // float
             2.718281828459045,        // double
-            2.718281828459045         // long double
+            2.718281828459045l        // long double
         } };
 
 #if defined(FASTCSV_PLATFORM_WIN)
@@ -170,7 +170,7 @@ namespace fastcsv::tests
             18446744072705551615ull,  // unsigned long long
             3.1415927f,               // float
             2.718281828459045,        // double
-            2.718281828459045         // long double
+            2.718281828459045l        // long double
         } };
 
         // Act
@@ -204,7 +204,7 @@ namespace fastcsv::tests
             18446744072705551615ull,  // unsigned long long
             3.1415927f,               // float
             2.718281828459045,        // double
-            2.718281828459045         // long double
+            2.718281828459045l        // long double
         } };
 
         // Act
@@ -0,0 +1,130 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    namespace
+    {
+        // Keeps the submitted tasks so a test decides when they run
+        struct deferred_executor
+        {
+            std::vector<std::function<void()>> * tasks;
+
+            void operator()(std::function<void()> task) const { tasks->push_back(std::move(task)); }
+        };
+    }  // namespace
+
+    TEST(async_tests, round_trip)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_async_tests_round_trip.csv";
+        auto expected = std::vector<std::tuple<int, std::string>>{ { 1, "a" }, { 2, "b, c" }, { 3, "" } };
+
+        // Act
+        save_csv_async(path, expected, no_header).get();
+        auto result = load_csv_async<std::tuple<int, std::string>>(path, no_header).get();
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        std::filesystem::remove(path);
+    }
+
+    TEST(async_tests, dropped_future_waits_for_task)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_async_tests_dropped.csv";
+        auto expected = std::vector<int>(100000ul, 7);
+
+        // Act
+        {
+            auto saved = save_csv_async(path, expected, no_header);
+        }
+
+        // Assert
+        EXPECT_EQ(load_csv<int>(path, no_header), expected);
+        std::filesystem::remove(path);
+    }
+
+    TEST(async_tests, runs_on_given_executor)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_async_tests_executor.csv";
+        auto tasks = std::vector<std::function<void()>>();
+        auto executor = deferred_executor{ &tasks };
+
+        // Act
+        auto saved = save_csv_async(path, std::vector{ 1, 2, 3 }, cancellation_token(), executor, no_header);
+        ASSERT_EQ(tasks.size(), 1ul);
+        EXPECT_FALSE(std::filesystem::exists(path));
+        tasks[0]();
+        saved.get();
+
+        auto loaded = load_csv_async<int>(path, cancellation_token(), executor, no_header);
+        tasks[1]();
+
+        // Assert
+        EXPECT_EQ(loaded.get(), (std::vector{ 1, 2, 3 }));
+        std::filesystem::remove(path);
+    }
+
+    TEST(async_tests, cancel_before_start)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_async_tests_cancel.csv";
+        auto tasks = std::vector<std::function<void()>>();
+        auto token = cancellation_token();
+
+        // Act
+        auto saved = save_csv_async(path, std::vector{ 1, 2, 3 }, token, deferred_executor{ &tasks });
+        token.cancel();
+        tasks[0]();
+
+        // Assert
+        EXPECT_THROW(saved.get(), operation_cancelled);
+        EXPECT_FALSE(std::filesystem::exists(path));
+    }
+
+    TEST(async_tests, cancel_while_reading)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_async_tests_cancel_reading.csv";
+        save_csv(path, std::vector{ 1, 2, 3, 4 }, no_header);
+        auto tasks = std::vector<std::function<void()>>();
+        auto token = cancellation_token();
+        auto cancelOnSecond = [token](int value) mutable {
+            if (value == 2) { token.cancel(); }
+            return value;
+        };
+
+        // Act
+        auto loaded = load_csv_async<int, int>(path, cancelOnSecond, token, deferred_executor{ &tasks }, no_header);
+        tasks[0]();
+
+        // Assert
+        EXPECT_THROW((void)loaded.get(), operation_cancelled);
+        std::filesystem::remove(path);
+    }
+
+    TEST(async_tests, failure_reaches_future)
+    {
+        // Act
+        auto loaded = load_csv_async<int>(std::filesystem::temp_directory_path() / "fastcsv_async_tests_missing.csv");
+
+        // Assert
+        EXPECT_THROW((void)loaded.get(), fastcsv_exception);
+    }
+
+    TEST(async_tests, thread_executor_is_a_tag)
+    {
+        EXPECT_TRUE(detail::is_executor_v<thread_executor>);
+        EXPECT_TRUE(detail::is_executor_v<const thread_executor>);
+        EXPECT_FALSE((std::is_invocable_v<thread_executor &, std::function<void()>>));
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,123 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+using namespace std::chrono_literals;
+
+
+namespace fastcsv::tests
+{
+
+    using namespace std::chrono;
+
+    TEST(chrono_tests, read_year_month_day)
+    {
+        // Arrange
+        auto str = "2021-03-04\n2020-02-29\n"s;
+
+        // Act
+        auto result = read_csv<year_month_day>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<year_month_day>{ 2021y / March / 4d, 2020y / February / 29d }));
+    }
+
+    TEST(chrono_tests, write_year_month_day)
+    {
+        // Arrange
+        auto data = std::vector<year_month_day>{ 2021y / March / 4d };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "2021-03-04\r\n"s;
+#else
+        auto expected = "2021-03-04\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(chrono_tests, read_timestamps)
+    {
+        // Arrange
+        auto str = "2021-03-04T05:06:07.123456789\n2021-03-04 05:06:07Z\n1969-12-31T23:59:59.5\n2021-03-04\n"s;
+        auto expected = std::vector<sys_time<nanoseconds>>{
+            sys_days(2021y / March / 4d) + 5h + 6min + 7s + 123456789ns,
+            sys_days(2021y / March / 4d) + 5h + 6min + 7s,
+            sys_days(1969y / December / 31d) + 23h + 59min + 59s + 500ms,
+            sys_days(2021y / March / 4d),
+        };
+
+        // Act
+        auto result = read_csv<sys_time<nanoseconds>>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(chrono_tests, parse_floors_to_duration)
+    {
+        EXPECT_EQ(
+            from_csv<sys_seconds>::parse("1969-12-31T23:59:59.999"sv),
+            sys_days(1969y / December / 31d) + 23h + 59min + 59s);
+        EXPECT_EQ(from_csv<sys_days>::parse("1969-12-31T23:59:59"sv), sys_days(1969y / December / 31d));
+    }
+
+    TEST(chrono_tests, parse_invalid_throws)
+    {
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse(""sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-02-29"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-13-01T00:00:00"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-01-01T24:00:00"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-01-01T00:60:00"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-01-01X00:00:00"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021/01/01T00:00:00"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-01-01T00:00:0a"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-01-01T00:00:00."sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<sys_seconds>::parse("2021-01-01T00:00:00.1234567891"sv), fastcsv_exception);
+    }
+
+    TEST(chrono_tests, write_timestamps)
+    {
+        // Arrange
+        auto data = std::vector<std::tuple<sys_time<nanoseconds>, sys_time<milliseconds>, sys_seconds, sys_days>>{
+            { sys_days(2021y / March / 4d) + 5h + 6min + 7s + 89ns,
+              sys_days(1969y / December / 31d) + 23h + 59min + 59s + 500ms,
+              sys_days(2021y / March / 4d),
+              sys_days(2021y / March / 4d) }
+        };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "2021-03-04T05:06:07.000000089,1969-12-31T23:59:59.500,2021-03-04T00:00:00,2021-03-04\r\n"s;
+#else
+        auto expected = "2021-03-04T05:06:07.000000089,1969-12-31T23:59:59.500,2021-03-04T00:00:00,2021-03-04\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(chrono_tests, round_trip_timestamps)
+    {
+        // Arrange
+        auto expected = std::vector<sys_time<microseconds>>{ sys_days(1900y / January / 1d) + 1us,
+                                                             sys_days(2000y / February / 29d) + 12h,
+                                                             sys_days(9999y / December / 31d) + 23h + 59min };
+
+        // Act
+        auto csvString = write_csv(expected);
+        auto result = read_csv<sys_time<microseconds>>(csvString, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,130 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    using price = decimal<4>;
+    using small_price = decimal<2, int32_t>;
+    using unsigned_price = decimal<4, uint64_t>;
+    using unsigned_count = decimal<0, uint64_t>;
+    using unsigned_cents = decimal<2, uint64_t>;
+    using fraction = decimal<19, uint64_t>;
+    using tiny_price = decimal<2, int8_t>;
+
+    TEST(decimal_tests, read)
+    {
+        // Arrange
+        auto str = "123.4500\n-0.0005\n7\n.5\n42.\n"s;
+        auto expected = std::vector<price>{ price::from_raw(1234500),
+                                            price::from_raw(-5),
+                                            price::from_raw(70000),
+                                            price::from_raw(5000),
+                                            price::from_raw(420000) };
+
+        // Act
+        auto result = read_csv<price>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(decimal_tests, write)
+    {
+        // Arrange
+        auto data = std::vector<price>{ price::from_raw(1234500), price::from_raw(-5), price::from_raw(0) };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "123.4500\r\n-0.0005\r\n0.0000\r\n"s;
+#else
+        auto expected = "123.4500\n-0.0005\n0.0000\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(decimal_tests, round_trip_limits)
+    {
+        // Arrange
+        auto expected = std::vector<decimal<2>>{ decimal<2>::from_raw(std::numeric_limits<int64_t>::max()),
+                                                 decimal<2>::from_raw(std::numeric_limits<int64_t>::min()) };
+
+        // Act
+        auto csvString = write_csv(expected);
+        auto result = read_csv<decimal<2>>(csvString, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(decimal_tests, parse_scale_zero)
+    {
+        EXPECT_EQ(from_csv<decimal<0>>::parse("-17"sv).raw(), -17);
+        EXPECT_EQ(from_csv<decimal<0>>::parse("17.000"sv).raw(), 17);
+    }
+
+    TEST(decimal_tests, parse_trailing_zeros_beyond_scale)
+    {
+        EXPECT_EQ(from_csv<decimal<2>>::parse("1.2300000"sv).raw(), 123);
+    }
+
+    TEST(decimal_tests, parse_inexact_throws)
+    {
+        EXPECT_THROW((void)from_csv<decimal<2>>::parse("1.234"sv), fastcsv_exception);
+    }
+
+    TEST(decimal_tests, parse_out_of_range_throws)
+    {
+        EXPECT_THROW((void)from_csv<decimal<2>>::parse("92233720368547758.08"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<small_price>::parse("21474836.48"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<unsigned_price>::parse("-1"sv), fastcsv_exception);
+    }
+
+    TEST(decimal_tests, parse_full_range)
+    {
+        EXPECT_EQ(from_csv<unsigned_count>::parse("18446744073709551615"sv).raw(), UINT64_MAX);
+        EXPECT_EQ(from_csv<unsigned_cents>::parse("184467440737095516.15"sv).raw(), UINT64_MAX);
+        EXPECT_EQ(from_csv<fraction>::parse("1.8446744073709551615"sv).raw(), UINT64_MAX);
+        EXPECT_EQ(from_csv<tiny_price>::parse("-1.28"sv).raw(), -128);
+        EXPECT_THROW((void)from_csv<unsigned_count>::parse("18446744073709551616"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<unsigned_cents>::parse("184467440737095516.16"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<tiny_price>::parse("1.28"sv), fastcsv_exception);
+    }
+
+    TEST(decimal_tests, parse_inexact_is_invalid)
+    {
+        // Arrange
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        (void)read_csv<decimal<2>>("1.234\n"s, error_policy::collect, errors, no_header);
+
+        // Assert
+        ASSERT_EQ(errors.size(), 1ul);
+        EXPECT_EQ(errors[0].code, std::errc::invalid_argument);
+    }
+
+    TEST(decimal_tests, parse_invalid_throws)
+    {
+        EXPECT_THROW((void)from_csv<price>::parse(""sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<price>::parse("."sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<price>::parse("-"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<price>::parse("1.2e3"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<price>::parse("1,2"sv), fastcsv_exception);
+    }
+
+    TEST(decimal_tests, to_double)
+    {
+        EXPECT_EQ(price::from_raw(1234500).to_double(), 123.45);
+    }
+
+}  // namespace fastcsv::tests
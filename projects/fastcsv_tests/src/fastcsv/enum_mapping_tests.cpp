@@ -0,0 +1,137 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv
+{
+
+    enum class side
+    {
+        buy,
+        sell,
+        unknown
+    };
+
+    enum class status : int32_t
+    {
+        open = -100000,
+        closed = 0,
+        cancelled = 100000
+    };
+
+    template <>
+    struct enum_mapping<side>
+    {
+        static constexpr std::array<std::pair<std::string_view, side>, 4> values{
+            { { "buy"sv, side::buy }, { "sell"sv, side::sell }, { "B"sv, side::buy }, { "S"sv, side::sell } }
+        };
+    };
+
+    enum class venue
+    {
+        primary,
+        dark
+    };
+
+    template <>
+    struct enum_mapping<venue>
+    {
+        static constexpr std::array<std::pair<std::string_view, venue>, 2> values{
+            { { "primary"sv, venue::primary }, { "dark, pool"sv, venue::dark } }
+        };
+    };
+
+    template <>
+    struct enum_mapping<status>
+    {
+        static constexpr std::array<std::pair<std::string_view, status>, 3> values{
+            { { "open"sv, status::open }, { "closed"sv, status::closed }, { "cancelled"sv, status::cancelled } }
+        };
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    TEST(enum_mapping_tests, read_with_aliases)
+    {
+        // Arrange
+        auto str = "buy\nsell\nB\nS\n"s;
+
+        // Act
+        auto result = read_csv<side>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector{ side::buy, side::sell, side::buy, side::sell }));
+    }
+
+    TEST(enum_mapping_tests, write_first_name)
+    {
+        // Arrange
+        auto data = std::vector{ side::buy, side::sell };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "buy\r\nsell\r\n"s;
+#else
+        auto expected = "buy\nsell\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(enum_mapping_tests, round_trip_sparse_values)
+    {
+        // Arrange
+        auto expected = std::vector{ status::cancelled, status::open, status::closed };
+
+        // Act
+        auto csvString = write_csv(expected);
+        auto result = read_csv<status>(csvString, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(enum_mapping_tests, parse_unknown_name_throws)
+    {
+        EXPECT_THROW((void)from_csv<side>::parse("Buy"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<side>::parse("buys"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<side>::parse(""sv), fastcsv_exception);
+    }
+
+    TEST(enum_mapping_tests, write_unmapped_value_throws)
+    {
+        EXPECT_THROW((void)write_csv(std::vector{ side::unknown }), fastcsv_exception);
+        EXPECT_THROW((void)write_csv(std::vector{ static_cast<status>(1) }), fastcsv_exception);
+    }
+
+    TEST(enum_mapping_tests, write_names_needing_quotes)
+    {
+        // Arrange
+        static_assert(csv_never_needs_quoting_v<side>);
+        static_assert(!csv_never_needs_quoting_v<venue>);
+        auto data = std::vector<std::tuple<venue, side>>{ { venue::primary, side::buy }, { venue::dark, side::sell } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "primary,buy\r\n\"dark, pool\",sell\r\n"s;
+#else
+        auto expected = "primary,buy\n\"dark, pool\",sell\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,228 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv
+{
+
+    // Converted through the standard library, which throws std::invalid_argument and std::out_of_range
+    struct legacy_count
+    {
+        long value;
+
+        bool operator==(const legacy_count & other) const noexcept { return value == other.value; }
+    };
+
+    template <>
+    struct from_csv<legacy_count> final : csv_reader
+    {
+        legacy_count operator()() const { return legacy_count{ std::stol(std::string(parser.consume_column())) }; }
+    };
+
+    // Fails on a missing reference file, which is not a problem with the field
+    struct lookup_code
+    {
+        int value;
+
+        bool operator==(const lookup_code & other) const noexcept { return value == other.value; }
+    };
+
+    template <>
+    struct from_csv<lookup_code> final : csv_reader
+    {
+        lookup_code operator()() const
+        {
+            const auto field = parser.consume_column();
+            if (field == "missing") { throw fastcsv_exception("Reference table not found"); }
+            if (field.empty()) { throw conversion_error("Empty code"); }
+            return lookup_code{ static_cast<int>(field.size()) };
+        }
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    using row = std::tuple<std::string, int, double>;
+    using legacy_row = std::tuple<std::string, legacy_count, double>;
+    using code_row = std::tuple<int, lookup_code>;
+
+    TEST(error_policy_tests, skip)
+    {
+        // Arrange
+        auto str = "name,count,price\na,1,1.5\nb,x,2.5\nc,3,3.5\nd,4,y\n"s;
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto result = read_csv<row>(str, error_policy::skip, errors);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<row>{ { "a", 1, 1.5 }, { "c", 3, 3.5 } }));
+        EXPECT_TRUE(errors.empty());
+    }
+
+    TEST(error_policy_tests, collect)
+    {
+        // Arrange
+        auto str = "name,count,price\na,1,1.5\nb,x,2.5\nc,3,3.5\nd,4,y\n"s;
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto result = read_csv<row>(str, error_policy::collect, errors);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<row>{ { "a", 1, 1.5 }, { "c", 3, 3.5 } }));
+
+        ASSERT_EQ(errors.size(), 2ul);
+        EXPECT_EQ(errors[0].row, 2ul);
+        EXPECT_EQ(errors[0].column, 1ul);
+        EXPECT_EQ(errors[0].offset, str.find('x'));
+        EXPECT_EQ(errors[0].code, std::errc::invalid_argument);
+        EXPECT_EQ(errors[1].row, 4ul);
+        EXPECT_EQ(errors[1].column, 2ul);
+        EXPECT_EQ(errors[1].offset, str.find('y'));
+        EXPECT_FALSE(errors[1].message().empty());
+    }
+
+    TEST(error_policy_tests, abort)
+    {
+        // Arrange
+        auto str = "a,1,1.5\nb,99999999999,2.5\nc,3,3.5\n"s;
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto result = read_csv<row>(str, error_policy::abort, errors, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<row>{ { "a", 1, 1.5 } }));
+
+        ASSERT_EQ(errors.size(), 1ul);
+        EXPECT_EQ(errors[0].row, 1ul);
+        EXPECT_EQ(errors[0].column, 1ul);
+        EXPECT_EQ(errors[0].code, std::errc::result_out_of_range);
+    }
+
+    TEST(error_policy_tests, throw_exception)
+    {
+        // Arrange
+        auto str = "a,1,1.5\nb,x,2.5\n"s;
+        auto errors = std::vector<csv_error>();
+
+        // Act / Assert
+        EXPECT_THROW((void)read_csv<row>(str, error_policy::throw_exception, errors, no_header), fastcsv_exception);
+    }
+
+    TEST(error_policy_tests, collect_thrown_errors)
+    {
+        // Arrange
+        auto str = "a,1,1.5\nb,x,2.5\nc,99999999999999999999,3.5\nd,4,4.5\n"s;
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto result = read_csv<legacy_row>(str, error_policy::collect, errors, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<legacy_row>{ { "a", { 1l }, 1.5 }, { "d", { 4l }, 4.5 } }));
+
+        ASSERT_EQ(errors.size(), 2ul);
+        EXPECT_EQ(errors[0].row, 1ul);
+        EXPECT_EQ(errors[0].column, 1ul);
+        EXPECT_EQ(errors[0].offset, str.find('x'));
+        EXPECT_EQ(errors[0].code, std::errc::invalid_argument);
+        EXPECT_EQ(errors[1].row, 2ul);
+        EXPECT_EQ(errors[1].column, 1ul);
+        EXPECT_EQ(errors[1].offset, str.find('9'));
+        EXPECT_EQ(errors[1].code, std::errc::result_out_of_range);
+    }
+
+    TEST(error_policy_tests, only_conversion_errors_are_collected)
+    {
+        // Arrange
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto result = read_csv<code_row>("1,ab\n2,\n3,c\n"s, error_policy::collect, errors, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<code_row>{ { 1, { 2 } }, { 3, { 1 } } }));
+        ASSERT_EQ(errors.size(), 1ul);
+        EXPECT_EQ(errors[0].row, 1ul);
+        EXPECT_EQ(errors[0].column, 1ul);
+        EXPECT_THROW(
+            (void)read_csv<code_row>("1,ab\n2,missing\n"s, error_policy::skip, errors, no_header),
+            fastcsv_exception);
+        EXPECT_THROW((void)read_csv<code_row>("1,\n"s, no_header), conversion_error);
+    }
+
+    TEST(error_policy_tests, read_csv_v_collect_thrown_errors)
+    {
+        // Arrange
+        auto str = "1,2\n3,x\n5,6\n"s;
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto [firsts, seconds] = read_csv_v<int, legacy_count>(str, error_policy::skip, errors, no_header);
+        (void)read_csv_v<int, legacy_count>(str, error_policy::collect, errors, no_header);
+
+        // Assert
+        EXPECT_EQ(firsts, (std::vector{ 1, 5 }));
+        EXPECT_EQ(seconds, (std::vector<legacy_count>{ { 2l }, { 6l } }));
+
+        ASSERT_EQ(errors.size(), 1ul);
+        EXPECT_EQ(errors[0].column, 1ul);
+        EXPECT_EQ(errors[0].offset, str.find('x'));
+    }
+
+    TEST(error_policy_tests, read_csv_v_collect)
+    {
+        // Arrange
+        auto str = "1,\"a\"\nx,\"b\"\n3,\"c\"\n"s;
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto [numbers, names] = read_csv_v<int, std::string>(str, error_policy::collect, errors, no_header);
+
+        // Assert
+        EXPECT_EQ(numbers, (std::vector{ 1, 3 }));
+        EXPECT_EQ(names, (std::vector{ "a"s, "c"s }));
+
+        ASSERT_EQ(errors.size(), 1ul);
+        EXPECT_EQ(errors[0].row, 1ul);
+        EXPECT_EQ(errors[0].column, 0ul);
+    }
+
+    TEST(error_policy_tests, memoized_failure_is_reported_every_time)
+    {
+        // Arrange
+        auto str = "x\n1\nx\n"s;
+        auto errors = std::vector<csv_error>();
+        auto memoStats = std::vector<memo_stats>();
+
+        // Act
+        auto [values] = read_csv_v<memoized<int>>(str, memoStats, error_policy::collect, errors, no_header);
+
+        // Assert
+        EXPECT_EQ(values, (std::vector{ 1 }));
+        EXPECT_EQ(errors.size(), 2ul);
+    }
+
+    TEST(error_policy_tests, load_csv_collect)
+    {
+        // Arrange
+        auto errors = std::vector<csv_error>();
+
+        // Act
+        auto result = load_csv<row>(data_path() / "error-policy.csv", error_policy::collect, errors);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<row>{ { "a", 1, 1.5 }, { "c", 3, 3.5 } }));
+        ASSERT_EQ(errors.size(), 1ul);
+        EXPECT_EQ(errors[0].row, 2ul);
+    }
+
+}  // namespace fastcsv::tests
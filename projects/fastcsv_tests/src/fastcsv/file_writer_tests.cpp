@@ -0,0 +1,127 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+
+namespace fastcsv
+{
+
+    struct tick
+    {
+        std::string symbol;
+        double price;
+    };
+
+    template <>
+    struct csv_headers<tick> final
+    {
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR std::vector<std::string_view> operator()() const noexcept
+        {
+            return std::vector<std::string_view>{ "symbol"sv, "price"sv };
+        }
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    namespace
+    {
+        std::string read_file(const std::filesystem::path & path)
+        {
+            auto file = std::ifstream(path, std::ios::in | std::ios::binary);
+            return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+    }  // namespace
+
+    TEST(file_writer_tests, append_rows)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_file_writer_tests_append.csv";
+        auto data = std::vector<tick>{ { "AAPL", 1.5 }, { "MSFT", 2.25 }, { "a, b", 3.0 } };
+
+        // Act
+        {
+            auto writer = csv_file_writer<tick>(path);
+            writer.append(data[0]);
+            writer.append(std::vector<tick>(data.begin() + 1, data.end()));
+            EXPECT_EQ(writer.rows(), 3ul);
+        }
+
+        // Assert
+        EXPECT_EQ(read_file(path), write_csv(data));
+        std::filesystem::remove(path);
+    }
+
+    TEST(file_writer_tests, flush_on_size)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_file_writer_tests_size.csv";
+        auto writer = csv_file_writer<tick>(path, no_header, 1ul, std::chrono::hours(1));
+
+        // Act
+        writer.append(tick{ "AAPL", 1.5 });
+
+        // Assert
+        EXPECT_EQ(read_file(path), write_csv(std::vector<tick>{ { "AAPL", 1.5 } }, no_header));
+        std::filesystem::remove(path);
+    }
+
+    TEST(file_writer_tests, flush_on_interval)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_file_writer_tests_interval.csv";
+        auto writer = csv_file_writer<tick>(path, std::nullopt, 1000000ul, std::chrono::milliseconds(0));
+
+        // Act
+        writer.append(tick{ "AAPL", 1.5 });
+
+        // Assert
+        EXPECT_EQ(read_file(path), write_csv(std::vector<tick>{ { "AAPL", 1.5 } }));
+        std::filesystem::remove(path);
+    }
+
+    TEST(file_writer_tests, buffer_until_flush)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_file_writer_tests_buffer.csv";
+        auto writer = csv_file_writer<tick>(path, no_header, 1000000ul, std::chrono::hours(1));
+
+        // Act
+        writer.append(tick{ "AAPL", 1.5 });
+        auto before = read_file(path);
+        writer.flush();
+
+        // Assert
+        EXPECT_TRUE(before.empty());
+        EXPECT_EQ(read_file(path), write_csv(std::vector<tick>{ { "AAPL", 1.5 } }, no_header));
+        std::filesystem::remove(path);
+    }
+
+    TEST(file_writer_tests, flush_if_due_while_idle)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_file_writer_tests_idle.csv";
+        auto writer = csv_file_writer<tick>(path, no_header, 1000000ul, std::chrono::milliseconds(20));
+        writer.append(tick{ "AAPL", 1.5 });
+
+        // Act
+        std::this_thread::sleep_for(std::chrono::milliseconds(40));
+        writer.flush_if_due();
+
+        // Assert
+        EXPECT_EQ(read_file(path), write_csv(std::vector<tick>{ { "AAPL", 1.5 } }, no_header));
+        std::filesystem::remove(path);
+    }
+
+    TEST(file_writer_tests, wrong_extension_throws)
+    {
+        EXPECT_THROW(csv_file_writer<tick>(std::filesystem::temp_directory_path() / "ticks.txt"), fastcsv_exception);
+    }
+
+}  // namespace fastcsv::tests
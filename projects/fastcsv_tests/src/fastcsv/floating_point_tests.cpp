@@ -0,0 +1,196 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv
+{
+
+    struct rounded_price
+    {
+        double px;
+    };
+
+    template <>
+    struct to_csv<rounded_price> final : csv_writer
+    {
+        void operator()(const rounded_price & value) { write(value.px, 2); }
+    };
+
+    struct scientific_price
+    {
+        double px;
+    };
+
+    template <>
+    struct to_csv<scientific_price> final : csv_writer
+    {
+        void operator()(const scientific_price & value) { write(value.px, "{:.3e}"sv); }
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    TEST(floating_point_tests, read_column)
+    {
+        // Arrange
+        auto str = "1.5\n-0.25\n100\n6.02214076e23\n.5\n"s;
+
+        // Act
+        auto result = read_csv<double>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<double>{ 1.5, -0.25, 100.0, 6.02214076e23, 0.5 }));
+    }
+
+    TEST(floating_point_tests, parse_double)
+    {
+        EXPECT_EQ(from_csv<double>::parse("0.1"sv), 0.1);
+        EXPECT_EQ(from_csv<double>::parse("2.718281828459045"sv), 2.718281828459045);
+        EXPECT_EQ(from_csv<double>::parse("1.7976931348623157e308"sv), 1.7976931348623157e308);
+        EXPECT_EQ(from_csv<double>::parse("2.2250738585072014E-308"sv), 2.2250738585072014e-308);
+        EXPECT_EQ(from_csv<double>::parse("4.9406564584124654e-324"sv), 4.9406564584124654e-324);
+        EXPECT_EQ(from_csv<double>::parse("123456.789e-3"sv), 123.456789);
+    }
+
+    TEST(floating_point_tests, parse_float)
+    {
+        EXPECT_EQ(from_csv<float>::parse("3.1415927"sv), 3.1415927f);
+        EXPECT_EQ(from_csv<float>::parse("3.4028235e38"sv), 3.4028235e38f);
+        EXPECT_EQ(from_csv<float>::parse("1e-45"sv), 1e-45f);
+    }
+
+    TEST(floating_point_tests, parse_rounds_half_to_even)
+    {
+        EXPECT_EQ(from_csv<double>::parse("9007199254740993"sv), 9007199254740992.0);
+        EXPECT_EQ(from_csv<double>::parse("9007199254740995"sv), 9007199254740996.0);
+        EXPECT_EQ(from_csv<float>::parse("16777217"sv), 16777216.0f);
+    }
+
+    TEST(floating_point_tests, parse_more_than_nineteen_digits)
+    {
+        EXPECT_EQ(from_csv<double>::parse("3.14159265358979323846264338327950288"sv), 3.14159265358979323846);
+        EXPECT_EQ(from_csv<double>::parse("0.000000000000000000000000000001"sv), 1e-30);
+        EXPECT_EQ(
+            from_csv<double>::parse("9007199254740993.0000000000000000000000000000001"sv),
+            9007199254740994.0);
+    }
+
+    TEST(floating_point_tests, parse_halfway_past_nineteen_digits)
+    {
+        // the 20th and later digits decide between the two neighbours, so the whole decimal is converted
+        EXPECT_EQ(from_csv<double>::parse("9007199254740993.00000000000000000000"sv), 9007199254740992.0);
+        EXPECT_EQ(from_csv<double>::parse("-9007199254740995.00000000000000000000"sv), -9007199254740996.0);
+        EXPECT_EQ(from_csv<double>::parse("9007199254740992.99999999999999999999"sv), 9007199254740992.0);
+        EXPECT_EQ(from_csv<float>::parse("16777217.0000000000000000000000"sv), 16777216.0f);
+        EXPECT_EQ(from_csv<float>::parse("16777217.0000000000000000000001"sv), 16777218.0f);
+        EXPECT_EQ(from_csv<float>::parse("1.40129846432481707092372958328991613e-45"sv), 1e-45f);
+    }
+
+    TEST(floating_point_tests, parse_special_values)
+    {
+        EXPECT_EQ(from_csv<double>::parse("inf"sv), std::numeric_limits<double>::infinity());
+        EXPECT_EQ(from_csv<double>::parse("-Infinity"sv), -std::numeric_limits<double>::infinity());
+        EXPECT_TRUE(std::isnan(from_csv<double>::parse("NaN"sv)));
+        EXPECT_TRUE(std::signbit(from_csv<double>::parse("-0.0"sv)));
+    }
+
+    TEST(floating_point_tests, parse_format)
+    {
+        EXPECT_EQ(from_csv<double>::parse("1.5e2"sv, std::chars_format::scientific), 150.0);
+        EXPECT_THROW((void)from_csv<double>::parse("150"sv, std::chars_format::scientific), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<double>::parse("1.5e2"sv, std::chars_format::fixed), fastcsv_exception);
+    }
+
+    TEST(floating_point_tests, parse_out_of_range_throws)
+    {
+        EXPECT_THROW((void)from_csv<double>::parse("1e400"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<double>::parse("1e-400"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<float>::parse("3.5e38"sv), fastcsv_exception);
+    }
+
+    TEST(floating_point_tests, parse_invalid_throws)
+    {
+        EXPECT_THROW((void)from_csv<double>::parse(""sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<double>::parse("."sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<double>::parse("1e"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<double>::parse("1.2.3"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<double>::parse("12345678.9abc"sv), fastcsv_exception);
+    }
+
+    TEST(floating_point_tests, write_shortest)
+    {
+        // Arrange
+        auto data = std::vector<std::tuple<double, float>>{ { 0.1, 0.1f }, { -2.5, 1e-10f }, { 1e300, 3.0f } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "0.1,0.1\r\n-2.5,1e-10\r\n1e+300,3\r\n"s;
+#else
+        auto expected = "0.1,0.1\n-2.5,1e-10\n1e+300,3\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(floating_point_tests, round_trip_shortest)
+    {
+        // Arrange
+        auto expected = std::vector<double>{ 1.0 / 3.0, 6.02214076e23, 5e-324, std::numeric_limits<double>::max(),
+                                             -std::numeric_limits<double>::min(), 123456789.125 };
+
+        // Act
+        auto csvString = write_csv(expected);
+        auto result = read_csv<double>(csvString, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(floating_point_tests, write_fixed_precision)
+    {
+        // Arrange
+        auto data = std::vector<rounded_price>{ { 1.005 }, { -2.0 }, { 1e20 } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "1.00\r\n-2.00\r\n100000000000000000000.00\r\n"s;
+#else
+        auto expected = "1.00\n-2.00\n100000000000000000000.00\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(floating_point_tests, write_with_format)
+    {
+        // Arrange
+        auto data = std::vector<scientific_price>{ { 1234.5 }, { -0.00025 } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "1.234e+03\r\n-2.500e-04\r\n"s;
+#else
+        auto expected = "1.234e+03\n-2.500e-04\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+}  // namespace fastcsv::tests
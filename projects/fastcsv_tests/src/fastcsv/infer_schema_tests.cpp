@@ -0,0 +1,114 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    TEST(infer_schema_tests, column_types)
+    {
+        // Arrange
+        auto str = "id,price,active,date,time,name,note\n"
+                   "1,1.5,true,2021-01-04,2021-01-04T05:06:07,\"a\",\n"
+                   "-2,3,f,2021-01-05,2021-01-05 05:06:07.5Z,b,x\n"
+                   "3,4e2,False,2021-01-06,2021-01-06,c,\n"s;
+
+        // Act
+        auto schema = infer_schema(str);
+
+        // Assert
+        EXPECT_EQ(schema.sampled_rows, 3ul);
+        ASSERT_EQ(schema.columns.size(), 7ul);
+
+        EXPECT_EQ(schema.columns[0].name, "id");
+        EXPECT_EQ(schema.columns[0].type, column_type::integer);
+        EXPECT_EQ(schema.columns[1].type, column_type::floating_point);
+        EXPECT_EQ(schema.columns[2].type, column_type::boolean);
+        EXPECT_EQ(schema.columns[3].type, column_type::date);
+        EXPECT_EQ(schema.columns[4].type, column_type::timestamp);
+        EXPECT_EQ(schema.columns[5].type, column_type::string);
+        EXPECT_EQ(schema.columns[6].type, column_type::string);
+
+        EXPECT_FALSE(schema.columns[0].nullable);
+        EXPECT_TRUE(schema.columns[6].nullable);
+    }
+
+    TEST(infer_schema_tests, empty_column_is_nullable_string)
+    {
+        // Arrange
+        auto str = "1,\n2,\n"s;
+
+        // Act
+        auto schema = infer_schema(str, 10ul, no_header);
+
+        // Assert
+        ASSERT_EQ(schema.columns.size(), 2ul);
+        EXPECT_EQ(schema.columns[0].name, "");
+        EXPECT_EQ(schema.columns[0].type, column_type::integer);
+        EXPECT_EQ(schema.columns[1].type, column_type::string);
+        EXPECT_TRUE(schema.columns[1].nullable);
+    }
+
+    TEST(infer_schema_tests, special_float_words_are_strings)
+    {
+        // Arrange
+        auto str = "symbol,price\nINF,1.5\nNaN,infinity\n"s;
+
+        // Act
+        auto schema = infer_schema(str);
+
+        // Assert
+        EXPECT_EQ(schema.columns[0].type, column_type::string);
+        EXPECT_EQ(schema.columns[1].type, column_type::string);
+    }
+
+    TEST(infer_schema_tests, quoted_empty_is_null)
+    {
+        // Arrange
+        auto str = "1,\"\"\n\"\",2.5\n"s;
+
+        // Act
+        auto schema = infer_schema(str, 10ul, no_header);
+
+        // Assert
+        EXPECT_EQ(schema.columns[0].type, column_type::integer);
+        EXPECT_EQ(schema.columns[1].type, column_type::floating_point);
+        EXPECT_TRUE(schema.columns[0].nullable);
+        EXPECT_TRUE(schema.columns[1].nullable);
+    }
+
+    TEST(infer_schema_tests, samples_spread_through_content)
+    {
+        // Arrange
+        auto str = "value\n"s;
+        for (auto i = 0; i < 1000; ++i)
+        {
+            str += i < 500 ? std::to_string(i) + "\n" : "0.5\n";
+        }
+
+        // Act
+        auto schema = infer_schema(str, 10ul);
+
+        // Assert
+        EXPECT_EQ(schema.sampled_rows, 10ul);
+        EXPECT_EQ(schema.columns[0].type, column_type::floating_point);
+    }
+
+    TEST(infer_schema_tests, skips_rows_with_other_column_counts)
+    {
+        // Arrange
+        auto str = "a,b\n1,\"x\ny\"\n2,z\n"s;
+
+        // Act
+        auto schema = infer_schema(str, 4ul);
+
+        // Assert
+        EXPECT_EQ(schema.columns[0].type, column_type::integer);
+        EXPECT_EQ(schema.columns[1].type, column_type::string);
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,149 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv
+{
+
+    struct padded_id
+    {
+        int id;
+    };
+
+    template <>
+    struct to_csv<padded_id> final : csv_writer
+    {
+        void operator()(const padded_id & value) { write(value.id, "{:06}"sv); }
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    TEST(integral_tests, read_column)
+    {
+        // Arrange
+        auto str = "1\n-22\n333\n1234567890123\n"s;
+
+        // Act
+        auto result = read_csv<long long>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<long long>{ 1ll, -22ll, 333ll, 1234567890123ll }));
+    }
+
+    TEST(integral_tests, parse_limits)
+    {
+        EXPECT_EQ(from_csv<int8_t>::parse("-128"sv), std::numeric_limits<int8_t>::min());
+        EXPECT_EQ(from_csv<int8_t>::parse("127"sv), std::numeric_limits<int8_t>::max());
+        EXPECT_EQ(from_csv<uint16_t>::parse("65535"sv), std::numeric_limits<uint16_t>::max());
+        EXPECT_EQ(from_csv<int32_t>::parse("-2147483648"sv), std::numeric_limits<int32_t>::min());
+        EXPECT_EQ(from_csv<uint32_t>::parse("4294967295"sv), std::numeric_limits<uint32_t>::max());
+        EXPECT_EQ(from_csv<int64_t>::parse("-9223372036854775808"sv), std::numeric_limits<int64_t>::min());
+        EXPECT_EQ(from_csv<int64_t>::parse("9223372036854775807"sv), std::numeric_limits<int64_t>::max());
+        EXPECT_EQ(from_csv<uint64_t>::parse("18446744073709551615"sv), std::numeric_limits<uint64_t>::max());
+    }
+
+    TEST(integral_tests, parse_leading_zeros)
+    {
+        EXPECT_EQ(from_csv<int>::parse("0"sv), 0);
+        EXPECT_EQ(from_csv<int>::parse("-0"sv), 0);
+        EXPECT_EQ(from_csv<uint64_t>::parse("000000000000000000000000042"sv), 42ull);
+    }
+
+    TEST(integral_tests, parse_out_of_range_throws)
+    {
+        EXPECT_THROW((void)from_csv<int8_t>::parse("128"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<int8_t>::parse("-129"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<uint32_t>::parse("4294967296"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<int64_t>::parse("9223372036854775808"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<uint64_t>::parse("18446744073709551616"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<uint64_t>::parse("100000000000000000000"sv), fastcsv_exception);
+    }
+
+    TEST(integral_tests, parse_invalid_throws)
+    {
+        EXPECT_THROW((void)from_csv<int>::parse(""sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<int>::parse("-"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<int>::parse("12a"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<int64_t>::parse("1234567/"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<int64_t>::parse("123456789012:"sv), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<unsigned>::parse("-1"sv), fastcsv_exception);
+    }
+
+    TEST(integral_tests, parse_hex)
+    {
+        EXPECT_EQ(from_csv<int>::parse("ff"sv, 16), 255);
+    }
+
+    TEST(integral_tests, parse_hex_out_of_range_throws)
+    {
+        EXPECT_EQ(from_csv<int8_t>::parse("-80"sv, 16), std::numeric_limits<int8_t>::min());
+        EXPECT_THROW((void)from_csv<int8_t>::parse("80"sv, 16), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<uint8_t>::parse("100"sv, 16), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<uint16_t>::parse("-1"sv, 16), fastcsv_exception);
+        EXPECT_THROW((void)from_csv<int>::parse("zz"sv, 16), fastcsv_exception);
+    }
+
+    TEST(integral_tests, write_with_format)
+    {
+        // Arrange
+        auto data = std::vector<padded_id>{ { 42 }, { -7 }, { 1234567 } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "000042\r\n-00007\r\n1234567\r\n"s;
+#else
+        auto expected = "000042\n-00007\n1234567\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(integral_tests, write_limits)
+    {
+        // Arrange
+        auto data = std::vector<std::tuple<int64_t, uint64_t, int8_t, int>>{
+            { std::numeric_limits<int64_t>::min(), std::numeric_limits<uint64_t>::max(), int8_t{ -128 }, 0 },
+            { std::numeric_limits<int64_t>::max(), 10u, int8_t{ 99 }, -100 }
+        };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "-9223372036854775808,18446744073709551615,-128,0\r\n9223372036854775807,10,99,-100\r\n"s;
+#else
+        auto expected = "-9223372036854775808,18446744073709551615,-128,0\n9223372036854775807,10,99,-100\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(integral_tests, round_trip_digit_counts)
+    {
+        // Arrange
+        auto expected = std::vector<uint64_t>();
+        for (auto value = uint64_t{ 1 }; value < uint64_t{ 10000000000000000000ull }; value *= 10u)
+        {
+            expected.insert(expected.end(), { value - 1u, value, value + 1u });
+        }
+
+        // Act
+        auto csvString = write_csv(expected);
+        auto result = read_csv<uint64_t>(csvString, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,109 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    TEST(locate_tests, new_lines)
+    {
+        // Arrange
+        auto str = "name,count,price\nalpha,1,1.5\nbravo,2,2.5\ncharlie,3,3.5\n"s;
+
+        // Act
+        auto start = locate(str, 0ul);
+        auto field = locate(str, str.find("2.5"));
+        auto middle = locate(str, str.find("harlie"));
+        auto end = locate(str, str.size());
+
+        // Assert
+        EXPECT_EQ(start.line, 0ul);
+        EXPECT_EQ(start.column, 0ul);
+        EXPECT_EQ(field.line, 2ul);
+        EXPECT_EQ(field.column, 2ul);
+        EXPECT_EQ(middle.line, 3ul);
+        EXPECT_EQ(middle.column, 0ul);
+        EXPECT_EQ(end.line, 4ul);
+        EXPECT_EQ(end.column, 0ul);
+    }
+
+    TEST(locate_tests, carriage_returns)
+    {
+        // Arrange
+        auto str = "aaaaaaaaaaaaaa\r\nbbbbbbbbbbbbbbb\r\nc,d\re,f\r\ng,h,i"s;
+
+        // Act
+        auto crlf = locate(str, str.find('d'));
+        auto lone = locate(str, str.find('f'));
+        auto last = locate(str, str.find('i'));
+
+        // Assert
+        EXPECT_EQ(crlf.line, 2ul);
+        EXPECT_EQ(crlf.column, 1ul);
+        EXPECT_EQ(lone.line, 3ul);
+        EXPECT_EQ(lone.column, 1ul);
+        EXPECT_EQ(last.line, 4ul);
+        EXPECT_EQ(last.column, 2ul);
+    }
+
+    TEST(locate_tests, quoted_line_ends)
+    {
+        // Arrange
+        auto str = "1,\"multi\nline\"\n2,\"a,b\"\n3,x\n"s;
+
+        // Act
+        auto inQuote = locate(str, str.find("line"));
+        auto afterQuote = locate(str, str.find('x'));
+
+        // Assert
+        EXPECT_EQ(inQuote.line, 0ul);
+        EXPECT_EQ(inQuote.column, 1ul);
+        EXPECT_EQ(afterQuote.line, 2ul);
+        EXPECT_EQ(afterQuote.column, 1ul);
+    }
+
+    TEST(locate_tests, matches_parser_lines)
+    {
+        // Arrange
+        auto str = std::string();
+        for (auto i = 0; i < 200; ++i)
+        {
+            str += std::to_string(i * 7919 % 1000);
+            str += (i % 3 == 0) ? "," : ((i % 5 == 0) ? "\r\n" : ((i % 7 == 0) ? "\r" : "\n"));
+        }
+
+        // Act / Assert
+        auto parser = detail::csv_parser(str);
+        auto line = 0ul;
+        do
+        {
+            auto location = locate(str, parser.line_start());
+            EXPECT_EQ(location.line, line);
+            EXPECT_EQ(location.column, 0ul);
+            ++line;
+        } while (parser.advance_line());
+    }
+
+    TEST(locate_tests, exception_offset)
+    {
+        // Arrange
+        auto str = "a,1\nb,2\nc,x\n"s;
+
+        // Act / Assert
+        try
+        {
+            (void)read_csv<std::tuple<std::string, int>>(str, no_header);
+            FAIL();
+        }
+        catch (const fastcsv_exception & exception)
+        {
+            EXPECT_EQ(exception.offset(), str.find('x'));
+            EXPECT_NE(std::string(exception.what()).find("line 2 column 1"), std::string::npos);
+        }
+    }
+
+}  // namespace fastcsv::tests
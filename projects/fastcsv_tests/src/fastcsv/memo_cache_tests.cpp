@@ -0,0 +1,101 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv
+{
+
+    struct trade
+    {
+        std::string symbol;
+        int quantity;
+
+        inline FASTCSV_CONSTEXPR bool operator==(const trade & other) const noexcept
+        {
+            return std::tie(symbol, quantity) == std::tie(other.symbol, other.quantity);
+        }
+    };
+
+    template <>
+    struct from_csv<trade> final : csv_reader
+    {
+        static inline memo_cache<std::string> symbols;
+
+        trade operator()() const { return trade{ read_cached(symbols), read<int>() }; }
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    TEST(memo_cache_tests, read_cached)
+    {
+        // Arrange
+        auto str = "\"AAPL\",1\n\"AAPL\",2\n\"MSFT\",3\n\"AAPL\",4\n"s;
+        auto expected = std::vector<trade>{ { "AAPL", 1 }, { "AAPL", 2 }, { "MSFT", 3 }, { "AAPL", 4 } };
+        from_csv<trade>::symbols.clear();
+
+        // Act
+        auto result = read_csv<trade>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ(from_csv<trade>::symbols.hits(), 2ul);
+        EXPECT_EQ(from_csv<trade>::symbols.misses(), 2ul);
+    }
+
+    TEST(memo_cache_tests, read_csv_v_memoized_column)
+    {
+        // Arrange
+        auto str = "date,px\n2021-01-04,1.5\n2021-01-04,2.5\n2021-01-04,3.5\n2021-01-05,4.5\n"s;
+        auto memoStats = std::vector<memo_stats>();
+
+        // Act
+        auto [dates, prices] = read_csv_v<memoized<std::string>, double>(str, memoStats);
+
+        // Assert
+        EXPECT_EQ(dates, (std::vector{ "2021-01-04"s, "2021-01-04"s, "2021-01-04"s, "2021-01-05"s }));
+        EXPECT_EQ(prices, (std::vector{ 1.5, 2.5, 3.5, 4.5 }));
+
+        ASSERT_EQ(memoStats.size(), 2ul);
+        EXPECT_EQ(memoStats[0].hits, 2ul);
+        EXPECT_EQ(memoStats[0].misses, 2ul);
+        EXPECT_EQ(memoStats[0].hit_rate(), 0.5);
+        EXPECT_EQ(memoStats[1].hits + memoStats[1].misses, 0ul);
+    }
+
+    TEST(memo_cache_tests, colliding_keys_are_converted)
+    {
+        // Arrange
+        auto str = "1\n2\n1\n2\n"s;
+        auto memoStats = std::vector<memo_stats>();
+
+        // Act
+        auto [values] = read_csv_v<memoized<int, 1ul>>(str, memoStats, no_header);
+
+        // Assert
+        EXPECT_EQ(values, (std::vector{ 1, 2, 1, 2 }));
+        EXPECT_EQ(memoStats[0].hits, 0ul);
+        EXPECT_EQ(memoStats[0].misses, 4ul);
+    }
+
+    TEST(memo_cache_tests, failed_conversion_is_not_cached)
+    {
+        // Arrange
+        auto str = "x\nx\n"s;
+        auto parser = detail::csv_parser(str);
+        auto cache = memo_cache<int>();
+
+        // Act / Assert
+        EXPECT_THROW((void)cache.convert(parser), fastcsv_exception);
+        parser.advance_line();
+        EXPECT_THROW((void)cache.convert(parser), fastcsv_exception);
+        EXPECT_EQ(cache.hits(), 0ul);
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,102 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    TEST(output_buffer_tests, grows_without_stream)
+    {
+        // Arrange
+        auto out = output_buffer();
+        auto expected = std::string(output_buffer::block_size * 3ul, 'x');
+
+        // Act
+        out.append(expected);
+        out.push_back('y');
+        out.flush();
+
+        // Assert
+        EXPECT_EQ(out.view(), expected + "y");
+    }
+
+    TEST(output_buffer_tests, flushes_blocks_to_stream)
+    {
+        // Arrange
+        auto stream = std::stringstream();
+        auto out = output_buffer(stream);
+        auto field = std::string(1000ul, 'x');
+
+        // Act
+        for (auto i = 0ul; i < 100ul; ++i)
+        {
+            out.append(field);
+        }
+        auto written = stream.str().size();
+        out.flush();
+
+        // Assert
+        EXPECT_GT(written, 0ul);
+        EXPECT_EQ(written % 1000ul, 0ul);
+        EXPECT_EQ(out.size(), 0ul);
+        EXPECT_EQ(stream.str().size(), 100000ul);
+    }
+
+    TEST(output_buffer_tests, reserve_and_commit)
+    {
+        // Arrange
+        auto out = output_buffer();
+
+        // Act
+        auto first = out.reserve(4ul);
+        first[0] = 'a';
+        first[1] = 'b';
+        out.commit(first + 2);
+
+        // Assert
+        EXPECT_EQ(out.view(), "ab");
+    }
+
+    TEST(output_buffer_tests, write_csv_to_buffer)
+    {
+        // Arrange
+        auto out = output_buffer();
+        auto data = std::vector<std::tuple<std::string, int, double>>{ { "a", 1, 1.5 }, { "b,c", -2, 0.25 } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "a,1,1.5\r\n\"b,c\",-2,0.25\r\n"s;
+#else
+        auto expected = "a,1,1.5\n\"b,c\",-2,0.25\n"s;
+#endif
+
+        // Act
+        write_csv(out, data);
+        write_csv_v(out, {}, std::vector<int>{ 3 });
+
+        // Assert
+        EXPECT_EQ(out.view(), expected + write_csv_v(std::vector<int>{ 3 }));
+    }
+
+    TEST(output_buffer_tests, large_save_matches_string)
+    {
+        // Arrange
+        auto data = std::vector<std::tuple<std::string, int64_t>>();
+        for (auto i = 0; i < 20000; ++i)
+        {
+            data.emplace_back("row" + std::to_string(i), int64_t{ i } * 1000003);
+        }
+        auto stream = std::stringstream();
+
+        // Act
+        write_csv(stream, data, no_header);
+
+        // Assert
+        EXPECT_GT(stream.str().size(), output_buffer::block_size);
+        EXPECT_EQ(stream.str(), write_csv(data, no_header));
+    }
+
+}  // namespace fastcsv::tests
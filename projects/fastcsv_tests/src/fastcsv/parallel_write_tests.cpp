@@ -0,0 +1,189 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+
+namespace fastcsv
+{
+
+    struct position
+    {
+        int64_t account;
+        std::string symbol;
+        double quantity;
+    };
+
+    template <>
+    struct csv_headers<position> final
+    {
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR std::vector<std::string_view> operator()() const noexcept
+        {
+            return std::vector<std::string_view>{ "account"sv, "symbol"sv, "quantity"sv };
+        }
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    namespace
+    {
+        std::vector<position> make_positions(size_t count)
+        {
+            auto result = std::vector<position>();
+            for (auto i = 0ul; i < count; ++i)
+            {
+                result.push_back(position{ static_cast<int64_t>(i), i % 7ul == 0ul ? "a,b" : "sym", i * 0.25 });
+            }
+            return result;
+        }
+    }  // namespace
+
+    TEST(parallel_write_tests, matches_sequential_across_rounds)
+    {
+        // Arrange
+        auto data = make_positions(detail::parallel_chunk_rows * 2ul + 17ul);
+
+        // Act
+        auto result = write_csv(data, parallel);
+
+        // Assert
+        EXPECT_EQ(result, write_csv(data));
+        EXPECT_EQ(result.rfind("account,symbol,quantity", 0ul), 0ul);
+    }
+
+    TEST(parallel_write_tests, chunks_keep_row_order)
+    {
+        // Arrange
+        auto data = make_positions(detail::parallel_chunk_rows * 9ul + 5ul);
+        auto adapter = detail::identity{};
+        auto rounds = 0ul;
+        auto result = std::string();
+        auto workers = detail::round_workers(4ul);
+
+        // Act
+        detail::format_parallel<position, position>(
+            data,
+            adapter,
+            no_header,
+            workers,
+            [&](const std::vector<output_buffer> & buffers, size_t count) {
+                ++rounds;
+                for (auto i = 0ul; i < count; ++i)
+                {
+                    result.append(buffers[i].view());
+                }
+            });
+
+        // Assert
+        EXPECT_EQ(rounds, 3ul);
+        EXPECT_EQ(result, write_csv(data, no_header));
+    }
+
+    TEST(parallel_write_tests, write_to_stream)
+    {
+        // Arrange
+        auto data = make_positions(1000ul);
+        auto stream = std::stringstream();
+
+        // Act
+        write_csv(stream, data, parallel, no_header);
+
+        // Assert
+        EXPECT_EQ(stream.str(), write_csv(data, no_header));
+    }
+
+    TEST(parallel_write_tests, write_empty)
+    {
+        // Arrange
+        auto data = std::vector<position>();
+
+        // Act
+        auto result = write_csv(data, parallel, no_header);
+
+        // Assert
+        EXPECT_EQ(result, "");
+    }
+
+    TEST(parallel_write_tests, save_csv)
+    {
+        // Arrange
+        auto data = make_positions(detail::parallel_chunk_rows * 3ul + 1ul);
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_parallel_write_tests.csv";
+
+        // Act
+        save_csv(path, data, parallel);
+
+        // Assert
+        auto file = std::ifstream(path, std::ios::in | std::ios::binary);
+        auto content = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        EXPECT_EQ(content, write_csv(data));
+
+        file.close();
+        std::filesystem::remove(path);
+    }
+
+    TEST(parallel_write_tests, workers_run_every_round)
+    {
+        // Arrange
+        auto workers = detail::round_workers(3ul);
+        auto calls = std::vector<std::atomic<size_t>>(3ul);
+        auto task = [&](size_t i) { ++calls[i]; };
+
+        // Act
+        workers.run(3ul, task);
+        workers.run(2ul, task);
+
+        // Assert
+        EXPECT_EQ(calls[0].load(), 2ul);
+        EXPECT_EQ(calls[1].load(), 2ul);
+        EXPECT_EQ(calls[2].load(), 1ul);
+    }
+
+    TEST(parallel_write_tests, workers_rethrow_task_errors)
+    {
+        // Arrange
+        auto workers = detail::round_workers(2ul);
+        auto failing = [](size_t i) {
+            if (i == 1ul) { throw fastcsv_exception("chunk failed"); }
+        };
+        auto succeeding = [](size_t) {};
+
+        // Act / Assert
+        EXPECT_THROW(workers.run(2ul, failing), fastcsv_exception);
+        EXPECT_NO_THROW(workers.run(2ul, succeeding));
+    }
+
+    TEST(parallel_write_tests, save_reports_failed_writes)
+    {
+        // Arrange
+        auto data = make_positions(1000ul);
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_parallel_write_tests_full.csv";
+        std::filesystem::remove(path);
+        std::filesystem::create_symlink("/dev/full", path);
+
+        // Act / Assert
+        EXPECT_THROW(save_csv(path, data), fastcsv_exception);
+        EXPECT_THROW(save_csv(path, data, parallel), fastcsv_exception);
+        EXPECT_THROW(save_csv_v(path, std::vector<int>{ 1, 2, 3 }), fastcsv_exception);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(parallel_write_tests, save_reports_unopened_file)
+    {
+        // Arrange
+        auto data = make_positions(10ul);
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_missing_directory" / "positions.csv";
+
+        // Act / Assert
+        EXPECT_THROW(save_csv(path, data), fastcsv_exception);
+        EXPECT_THROW(save_csv(path, data, parallel), fastcsv_exception);
+    }
+
+}  // namespace fastcsv::tests
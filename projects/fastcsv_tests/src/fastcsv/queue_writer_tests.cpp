@@ -0,0 +1,235 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+
+namespace fastcsv
+{
+
+    struct audit_entry
+    {
+        int64_t producer;
+        int64_t sequence;
+        std::string action;
+    };
+
+    template <>
+    struct csv_headers<audit_entry> final
+    {
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR std::vector<std::string_view> operator()() const noexcept
+        {
+            return std::vector<std::string_view>{ "producer"sv, "sequence"sv, "action"sv };
+        }
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    TEST(queue_writer_tests, ring_is_bounded)
+    {
+        // Arrange
+        auto ring = detail::mpsc_ring<int>(3ul);
+        auto value = 0;
+
+        // Act / Assert
+        EXPECT_EQ(ring.capacity(), 4ul);
+        EXPECT_FALSE(ring.try_pop(value));
+        for (auto i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(ring.try_push(i));
+        }
+        EXPECT_FALSE(ring.try_push(4));
+
+        EXPECT_TRUE(ring.try_pop(value));
+        EXPECT_EQ(value, 0);
+        EXPECT_TRUE(ring.try_push(4));
+
+        for (auto i = 1; i < 5; ++i)
+        {
+            EXPECT_TRUE(ring.try_pop(value));
+            EXPECT_EQ(value, i);
+        }
+        EXPECT_FALSE(ring.try_pop(value));
+    }
+
+    TEST(queue_writer_tests, ring_capacity_limits)
+    {
+        EXPECT_EQ(detail::mpsc_ring<int>(0ul).capacity(), 2ul);
+        EXPECT_EQ(detail::mpsc_ring<int>(1ul).capacity(), 2ul);
+        EXPECT_EQ(detail::mpsc_ring<int>(5ul).capacity(), 8ul);
+        EXPECT_THROW(detail::mpsc_ring<int>(detail::mpsc_ring<int>::max_capacity + 1ul), fastcsv_exception);
+    }
+
+    TEST(queue_writer_tests, ring_refuses_after_close)
+    {
+        // Arrange
+        auto ring = detail::mpsc_ring<int>(4ul);
+        auto value = 0;
+        EXPECT_TRUE(ring.try_push(1));
+
+        // Act
+        ring.close();
+
+        // Assert
+        EXPECT_TRUE(ring.closed());
+        EXPECT_FALSE(ring.try_push(2));
+        EXPECT_FALSE(ring.drained());
+        EXPECT_TRUE(ring.try_pop(value));
+        EXPECT_EQ(value, 1);
+        EXPECT_TRUE(ring.drained());
+    }
+
+    TEST(queue_writer_tests, ring_skips_failed_copy)
+    {
+        // Arrange
+        struct throwing_copy
+        {
+            int value = 0;
+
+            throwing_copy() = default;
+            explicit throwing_copy(int v) : value(v) {}
+            throwing_copy(const throwing_copy &) = default;
+            throwing_copy(throwing_copy &&) noexcept = default;
+            throwing_copy & operator=(throwing_copy &&) noexcept = default;
+
+            throwing_copy & operator=(const throwing_copy & other)
+            {
+                if (other.value < 0) { throw fastcsv_exception("copy failed"); }
+                value = other.value;
+                return *this;
+            }
+        };
+
+        auto ring = detail::mpsc_ring<throwing_copy>(4ul);
+        const auto failing = throwing_copy(-1);
+        auto value = throwing_copy();
+
+        // Act
+        EXPECT_THROW(static_cast<void>(ring.try_push(failing)), fastcsv_exception);
+        EXPECT_TRUE(ring.try_push(throwing_copy(7)));
+
+        // Assert
+        EXPECT_TRUE(ring.try_pop(value));
+        EXPECT_EQ(value.value, 7);
+        EXPECT_FALSE(ring.try_pop(value));
+    }
+
+    TEST(queue_writer_tests, push_after_close_throws)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_queue_writer_tests_closed.csv";
+        auto writer = csv_queue_writer<audit_entry>(path, no_header, 4ul);
+        writer.push(audit_entry{ 0, 0, "open" });
+
+        // Act
+        writer.close();
+
+        // Assert
+        EXPECT_FALSE(writer.try_push(audit_entry{ 0, 1, "late" }));
+        EXPECT_THROW(writer.push(audit_entry{ 0, 2, "late" }), fastcsv_exception);
+        EXPECT_EQ(load_csv<audit_entry>(path, no_header).size(), 1ul);
+        std::filesystem::remove(path);
+    }
+
+    TEST(queue_writer_tests, many_producers)
+    {
+        // Arrange
+        const auto producers = 4l;
+        const auto rows = 20000l;
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_queue_writer_tests.csv";
+
+        // Act
+        {
+            auto writer = csv_queue_writer<audit_entry>(path, std::nullopt, 64ul);
+            auto threads = std::vector<std::thread>();
+            for (auto producer = 0l; producer < producers; ++producer)
+            {
+                threads.emplace_back([&writer, producer, rows]() {
+                    for (auto sequence = 0l; sequence < rows; ++sequence)
+                    {
+                        writer.push(audit_entry{ producer, sequence, "fill, partial" });
+                    }
+                });
+            }
+            for (auto & thread : threads)
+            {
+                thread.join();
+            }
+            writer.close();
+        }
+
+        // Assert
+        auto result = load_csv<audit_entry>(path);
+        ASSERT_EQ(result.size(), static_cast<size_t>(producers * rows));
+
+        // every producer's rows arrive in the order it pushed them
+        auto next = std::vector<int64_t>(producers, 0l);
+        for (const auto & entry : result)
+        {
+            EXPECT_EQ(entry.sequence, next[static_cast<size_t>(entry.producer)]++);
+            EXPECT_EQ(entry.action, "fill, partial");
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(queue_writer_tests, producers_race_close)
+    {
+        // Arrange
+        const auto producers = 4l;
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_queue_writer_tests_race.csv";
+
+        for (auto attempt = 0; attempt < 20; ++attempt)
+        {
+            auto accepted = std::atomic<size_t>(0ul);
+            auto started = std::atomic<long>(0l);
+
+            // Act
+            {
+                auto writer = csv_queue_writer<audit_entry>(path, no_header, 16ul);
+                auto threads = std::vector<std::thread>();
+                for (auto producer = 0l; producer < producers; ++producer)
+                {
+                    threads.emplace_back([&writer, &accepted, &started, producer]() {
+                        ++started;
+                        try
+                        {
+                            for (auto sequence = 0l;; ++sequence)
+                            {
+                                writer.push(audit_entry{ producer, sequence, "race" });
+                                ++accepted;
+                            }
+                        }
+                        catch (const fastcsv_exception &)
+                        {
+                        }
+                    });
+                }
+
+                while (started.load() < producers)
+                {
+                    std::this_thread::yield();
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(100 * attempt));
+                writer.close();
+
+                for (auto & thread : threads)
+                {
+                    thread.join();
+                }
+            }
+
+            // Assert
+            ASSERT_EQ(load_csv<audit_entry>(path, no_header).size(), accepted.load());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,290 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+
+namespace fastcsv
+{
+
+    struct quote_bar
+    {
+        int64_t time;
+        double open;
+        double close;
+        int32_t volume;
+
+        bool operator==(const quote_bar & other) const
+        {
+            return time == other.time && open == other.open && close == other.close && volume == other.volume;
+        }
+    };
+
+    template <>
+    struct csv_headers<quote_bar> final
+    {
+        FASTCSV_NO_DISCARD FASTCSV_CONSTEXPR std::vector<std::string_view> operator()() const noexcept
+        {
+            return std::vector<std::string_view>{ "time"sv, "open"sv, "close"sv, "volume"sv };
+        }
+    };
+
+    template <>
+    struct csv_snapshot_copyable<quote_bar> : std::true_type
+    {
+    };
+
+    struct quote_label
+    {
+        std::string_view symbol;
+        double price;
+    };
+
+}  // namespace fastcsv
+
+namespace fastcsv::tests
+{
+
+    namespace
+    {
+        std::vector<quote_bar> make_bars(size_t rows)
+        {
+            auto result = std::vector<quote_bar>();
+            for (auto i = 0ul; i < rows; ++i)
+            {
+                const auto value = static_cast<int64_t>(i);
+                result.push_back(quote_bar{ value, 0.5 * value, 0.25 * value, static_cast<int32_t>(i % 1000ul) });
+            }
+            return result;
+        }
+    }  // namespace
+
+    TEST(snapshot_tests, round_trip_rows)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_rows.snapshot";
+        auto expected = make_bars(10000ul);
+
+        // Act
+        save_snapshot(path, expected);
+        auto result = load_snapshot<quote_bar>(path);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        std::filesystem::remove(path);
+    }
+
+    TEST(snapshot_tests, round_trip_columns)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_columns.snapshot";
+        auto expected = read_csv_v<int, std::string, double>("1,two,3.5\n4,,6\n7,\"eight, nine\",10.25\n"s, no_header);
+
+        // Act
+        std::apply([&path](const auto &... columns) { save_snapshot_v(path, columns...); }, expected);
+        auto result = load_snapshot_v<int, std::string, double>(path);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        std::filesystem::remove(path);
+    }
+
+    TEST(snapshot_tests, empty_columns)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_empty.snapshot";
+
+        // Act
+        save_snapshot_v(path, std::vector<int>(), std::vector<std::string>());
+        auto result = load_snapshot_v<int, std::string>(path);
+
+        // Assert
+        EXPECT_TRUE(std::get<0>(result).empty());
+        EXPECT_TRUE(std::get<1>(result).empty());
+        std::filesystem::remove(path);
+    }
+
+    TEST(snapshot_tests, other_types_throw)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_types.snapshot";
+        save_snapshot_v(path, std::vector<int>{ 1, 2 }, std::vector<std::string>{ "a", "b" });
+
+        // Act / Assert
+        EXPECT_THROW((void)(load_snapshot_v<int, double>(path)), fastcsv_exception);
+        EXPECT_THROW((void)(load_snapshot_v<int>(path)), fastcsv_exception);
+        EXPECT_THROW((void)load_snapshot<quote_bar>(path), fastcsv_exception);
+        std::filesystem::remove(path);
+    }
+
+    TEST(snapshot_tests, only_copyable_types_are_stored_as_bytes)
+    {
+        EXPECT_TRUE(detail::is_snapshot_column_v<int64_t>);
+        EXPECT_TRUE(detail::is_snapshot_column_v<std::chrono::milliseconds>);
+        EXPECT_TRUE((detail::is_snapshot_column_v<decimal<2, int64_t>>));
+        EXPECT_TRUE(detail::is_snapshot_column_v<std::string>);
+        EXPECT_TRUE(detail::is_snapshot_column_v<quote_bar>);
+        EXPECT_FALSE(detail::is_snapshot_column_v<std::string_view>);
+        EXPECT_FALSE(detail::is_snapshot_column_v<const char *>);
+        EXPECT_FALSE(detail::is_snapshot_column_v<quote_label>);
+    }
+
+    TEST(snapshot_tests, temporary_paths_are_unique)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests.snapshot";
+
+        // Act
+        auto first = detail::temporary_path(path);
+        auto second = detail::temporary_path(path);
+
+        // Assert
+        EXPECT_NE(first, second);
+        EXPECT_EQ(first.parent_path(), path.parent_path());
+    }
+
+    TEST(snapshot_tests, wrapping_row_count_throws)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_rows.snapshot";
+        save_snapshot(path, std::vector<int64_t>{ 1, 2, 3 });
+        {
+            // rows * 8 wraps around to the real column size
+            const auto rows = uint64_t{ 3ull } + (uint64_t{ 1ull } << 61u);
+            auto file = std::fstream(path, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(static_cast<std::streamoff>(offsetof(detail::snapshot_header, rows)));
+            file.write(reinterpret_cast<const char *>(&rows), sizeof(rows));
+        }
+
+        // Act / Assert
+        EXPECT_THROW((void)load_snapshot<int64_t>(path), fastcsv_exception);
+        std::filesystem::remove(path);
+    }
+
+    TEST(snapshot_tests, not_a_snapshot_throws)
+    {
+        EXPECT_THROW((void)load_snapshot<int>(data_path() / "headers.csv"), fastcsv_exception);
+    }
+
+    TEST(snapshot_tests, load_csv_through_cache)
+    {
+        // Arrange
+        auto directory = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_cache";
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_cache.csv";
+        std::filesystem::remove_all(directory);
+        auto expected = make_bars(1000ul);
+        save_csv(path, expected);
+
+        // Act
+        auto first = load_csv<quote_bar>(path, directory);
+        ASSERT_EQ(std::distance(std::filesystem::directory_iterator(directory), {}), 1l);
+        auto snapshotPath = std::filesystem::directory_iterator(directory)->path();
+
+        // the source is unchanged, so a snapshot with other rows is taken as it is
+        auto fingerprint
+            = std::string(detail::mapped_file(snapshotPath).view().substr(0ul, sizeof(detail::snapshot_header)));
+        save_snapshot(snapshotPath, make_bars(3ul));
+        {
+            auto file = std::fstream(snapshotPath, std::ios::in | std::ios::out | std::ios::binary);
+            auto header = detail::snapshot_header();
+            std::memcpy(&header, fingerprint.data(), sizeof(header));
+            file.seekp(static_cast<std::streamoff>(offsetof(detail::snapshot_header, source)));
+            file.write(reinterpret_cast<const char *>(&header.source), sizeof(header.source));
+        }
+        auto cached = load_csv<quote_bar>(path, directory);
+
+        // a changed source is parsed again
+        expected.pop_back();
+        save_csv(path, expected);
+        auto reloaded = load_csv<quote_bar>(path, directory);
+
+        // Assert
+        EXPECT_EQ(first, make_bars(1000ul));
+        EXPECT_EQ(cached, make_bars(3ul));
+        EXPECT_EQ(reloaded, expected);
+        EXPECT_EQ(load_snapshot<quote_bar>(snapshotPath), expected);
+        std::filesystem::remove_all(directory);
+        std::filesystem::remove(path);
+    }
+
+    TEST(snapshot_tests, same_size_and_time_is_hashed)
+    {
+        // Arrange
+        auto directory = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_hashed";
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_hashed.csv";
+        std::filesystem::remove_all(directory);
+        auto expected = make_bars(100ul);
+        save_csv(path, expected, no_header);
+        (void)load_csv<quote_bar>(path, directory, no_header);
+
+        // the same number of bytes written back with the old modification time
+        const auto modified = std::filesystem::last_write_time(path);
+        expected[1].volume = 2;
+        save_csv(path, expected, no_header);
+        std::filesystem::last_write_time(path, modified);
+
+        // Act
+        auto result = load_csv<quote_bar>(path, directory, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        std::filesystem::remove_all(directory);
+        std::filesystem::remove(path);
+    }
+
+    TEST(snapshot_tests, corrupt_cache_is_rebuilt)
+    {
+        // Arrange
+        auto directory = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_corrupt";
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_corrupt.csv";
+        std::filesystem::remove_all(directory);
+        auto expected = make_bars(100ul);
+        save_csv(path, expected, no_header);
+        (void)load_csv<quote_bar>(path, directory, no_header);
+        auto snapshotPath = std::filesystem::directory_iterator(directory)->path();
+        std::filesystem::resize_file(snapshotPath, 10ul);
+
+        // Act
+        auto result = load_csv<quote_bar>(path, directory, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ(load_snapshot<quote_bar>(snapshotPath), expected);
+        std::filesystem::remove_all(directory);
+        std::filesystem::remove(path);
+    }
+
+#if defined(FASTCSV_HAS_ZLIB)
+    TEST(snapshot_tests, load_gzip_through_cache)
+    {
+        // Arrange
+        auto directory = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_gzip";
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_snapshot_tests_gzip.csv.gz";
+        std::filesystem::remove_all(directory);
+        auto expected = make_bars(1000ul);
+        auto content = write_csv(expected);
+        auto file = ::gzopen(path.string().c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(
+            ::gzwrite(file, content.data(), static_cast<unsigned>(content.size())), static_cast<int>(content.size()));
+        ::gzclose(file);
+
+        // Act
+        auto first = load_csv<quote_bar>(path, directory);
+        ASSERT_EQ(std::distance(std::filesystem::directory_iterator(directory), {}), 1l);
+        auto snapshotPath = std::filesystem::directory_iterator(directory)->path();
+        auto cached = load_csv<quote_bar>(path, directory);
+
+        // Assert
+        EXPECT_EQ(first, expected);
+        EXPECT_EQ(cached, expected);
+        EXPECT_EQ(load_snapshot<quote_bar>(snapshotPath), expected);
+        std::filesystem::remove_all(directory);
+        std::filesystem::remove(path);
+    }
+#endif
+
+}  // namespace fastcsv::tests
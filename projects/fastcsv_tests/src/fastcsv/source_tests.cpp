@@ -0,0 +1,272 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    namespace
+    {
+        using row_type = std::tuple<int64_t, std::string>;
+
+        // Hands out a string in small uneven reads
+        class string_source
+        {
+        public:
+            explicit string_source(std::string content) : content_(std::move(content)), position_(0ul) {}
+
+            size_t read(char * dest, size_t count)
+            {
+                const auto bytes = std::min({ count, content_.size() - position_, size_t{ 65537ul } });
+                std::memcpy(dest, content_.data() + position_, bytes);
+                position_ += bytes;
+                return bytes;
+            }
+
+            bool exhausted() const noexcept { return position_ == content_.size(); }
+
+        private:
+            std::string content_;
+            size_t position_;
+        };
+
+        // Several batches of rows, some with line ends inside quoted fields
+        std::string make_content(size_t rows)
+        {
+            auto result = "id,text\n"s;
+            for (auto i = 0ul; i < rows; ++i)
+            {
+                result += std::to_string(i);
+                result += i % 7ul == 0ul ? ",\"multi\nline, \"\"quoted\"\"\"\n" : ",plain text\n";
+            }
+            return result;
+        }
+
+        // Rows as write_csv produces them, the first with an escaped quote and the rest spanning two lines
+        std::string make_escaped_content(size_t rows)
+        {
+            auto data = std::vector<row_type>{ { 0, "he said \"x" } };
+            for (auto i = 1ul; i < rows; ++i)
+            {
+                data.emplace_back(static_cast<int64_t>(i), "line one\nline two");
+            }
+            return write_csv(data, no_header);
+        }
+    }  // namespace
+
+    TEST(source_tests, read_across_batches)
+    {
+        // Arrange
+        auto content = make_content(300000ul);
+        auto source = string_source(content);
+        static_assert(is_input_source_v<string_source>);
+
+        // Act
+        auto result = read_csv_source<row_type>(source);
+
+        // Assert
+        EXPECT_GT(content.size(), detail::source_batch_size);
+        EXPECT_EQ(result, read_csv<row_type>(content));
+    }
+
+    TEST(source_tests, escaped_quote_before_batch_boundary)
+    {
+        // Arrange
+        auto content = make_escaped_content(400000ul);
+        auto source = string_source(content);
+
+        // Act
+        auto result = read_csv_source<row_type>(source, no_header);
+
+        // Assert
+        EXPECT_GT(content.size(), detail::source_batch_size);
+        ASSERT_EQ(result.size(), 400000ul);
+        EXPECT_EQ(result, read_csv<row_type>(content, no_header));
+    }
+
+    TEST(source_tests, splitter_waits_for_character_after_carriage_return)
+    {
+        // Arrange
+        auto splitter = detail::record_splitter();
+
+        // Act / Assert
+        EXPECT_EQ(splitter.scan("1,a\r"), 0ul);
+        EXPECT_EQ(splitter.scan("1,a\r\n2,b\r"), 5ul);
+        EXPECT_EQ(splitter.scan("1,a\r\n2,b\r3"), 9ul);
+        EXPECT_EQ(splitter.scan("1,a\r\n2,b\r3,\"x\ry\""), 9ul);
+    }
+
+    TEST(source_tests, carriage_return_line_ends_across_batches)
+    {
+        // Arrange
+        auto content = make_content(300000ul);
+        std::replace(content.begin(), content.end(), '\n', '\r');
+        auto source = string_source(content);
+        auto batched = false;
+        auto adapter = [&source, &batched](row_type && row) {
+            batched = batched || !source.exhausted();
+            return std::move(row);
+        };
+
+        // Act
+        auto result = read_csv_source<row_type, row_type>(source, adapter);
+
+        // Assert
+        EXPECT_GT(content.size(), detail::source_batch_size);
+        EXPECT_TRUE(batched);
+        ASSERT_EQ(result.size(), 300000ul);
+        EXPECT_EQ(result, read_csv<row_type>(content));
+    }
+
+    TEST(source_tests, pipelined)
+    {
+        // Arrange
+        auto content = make_content(300000ul);
+        auto source = pipelined_source<string_source>(string_source(content));
+
+        // Act
+        auto result = read_csv_source<row_type>(source);
+
+        // Assert
+        EXPECT_EQ(result, read_csv<row_type>(content));
+    }
+
+    TEST(source_tests, errors_are_located_in_whole_input)
+    {
+        // Arrange
+        auto content = make_content(300000ul);
+        content.replace(content.rfind("\n29"), 3ul, "\nx9");
+        auto errors = std::vector<csv_error>();
+        auto expectedErrors = std::vector<csv_error>();
+        auto source = string_source(content);
+
+        // Act
+        auto result = read_csv_source<row_type>(source, error_policy::collect, errors);
+        auto expected = read_csv<row_type>(content, error_policy::collect, expectedErrors);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        ASSERT_EQ(errors.size(), 1ul);
+        EXPECT_GT(errors[0].offset, detail::source_batch_size);
+        EXPECT_EQ(errors[0].row, expectedErrors[0].row);
+        EXPECT_EQ(errors[0].offset, expectedErrors[0].offset);
+    }
+
+    TEST(source_tests, exception_is_located_in_whole_input)
+    {
+        // Arrange
+        auto content = make_content(300000ul);
+        content.replace(content.rfind("\n29"), 3ul, "\nx9");
+        auto source = string_source(content);
+        auto expected = std::string();
+        try
+        {
+            (void)read_csv<row_type>(content);
+        }
+        catch (const fastcsv_exception & exception)
+        {
+            expected = exception.what();
+        }
+
+        // Act / Assert
+        try
+        {
+            (void)read_csv_source<row_type>(source);
+            FAIL();
+        }
+        catch (const fastcsv_exception & exception)
+        {
+            EXPECT_EQ(std::string(exception.what()), expected);
+        }
+    }
+
+    TEST(source_tests, exception_after_multi_line_fields_is_located_in_whole_input)
+    {
+        // Arrange
+        auto content = make_escaped_content(400000ul);
+        content.replace(content.rfind("\n399999,"), 2ul, "\nx");
+        auto source = string_source(content);
+
+        // Act / Assert
+        try
+        {
+            (void)read_csv_source<row_type>(source, no_header);
+            FAIL();
+        }
+        catch (const fastcsv_exception & exception)
+        {
+            EXPECT_NE(std::string(exception.what()).find("line 399999 column 0"), std::string::npos);
+        }
+    }
+
+    TEST(source_tests, file_source)
+    {
+        // Arrange
+        auto source = file_source(data_path() / "headers.csv");
+
+        // Act
+        auto result = read_csv_source<std::tuple<int, std::string>>(source);
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<std::tuple<int, std::string>>{ { 1, "two" }, { 3, "four" } }));
+    }
+
+#if defined(FASTCSV_HAS_ZLIB)
+    TEST(source_tests, load_gzip)
+    {
+        // Act
+        auto result = load_csv<std::tuple<int, std::string>>(data_path() / "headers.csv.gz");
+
+        // Assert
+        EXPECT_EQ(result, (std::vector<std::tuple<int, std::string>>{ { 1, "two" }, { 3, "four" } }));
+    }
+
+    TEST(source_tests, load_large_gzip)
+    {
+        // Arrange
+        auto content = make_content(300000ul);
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_source_tests.csv.gz";
+        auto file = ::gzopen(path.string().c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(
+            ::gzwrite(file, content.data(), static_cast<unsigned>(content.size())), static_cast<int>(content.size()));
+        ::gzclose(file);
+
+        // Act
+        auto result = load_csv<row_type>(path);
+        auto streamed = load_csv<row_type>(path, uncached);
+
+        // Assert
+        EXPECT_EQ(result, read_csv<row_type>(content));
+        EXPECT_EQ(streamed, result);
+        std::filesystem::remove(path);
+    }
+
+    TEST(source_tests, load_gzip_async_and_uncached)
+    {
+        // Arrange
+        auto path = data_path() / "headers.csv.gz";
+        auto expected = std::vector<std::tuple<int, std::string>>{ { 1, "two" }, { 3, "four" } };
+
+        // Act
+        auto loaded = load_csv_async<std::tuple<int, std::string>>(path).get();
+        auto streamed = load_csv<std::tuple<int, std::string>>(path, uncached);
+
+        // Assert
+        EXPECT_EQ(loaded, expected);
+        EXPECT_EQ(streamed, expected);
+    }
+
+    TEST(source_tests, load_missing_gzip_throws)
+    {
+        EXPECT_THROW(
+            (void)load_csv<row_type>(std::filesystem::temp_directory_path() / "fastcsv_missing.csv.gz"),
+            fastcsv_exception);
+    }
+#endif
+
+}  // namespace fastcsv::tests
@@ -90,4 +90,99 @@ namespace fastcsv::tests
         EXPECT_EQ(result[0], "\"some string\""s);
     }
 
-}  // namespace fastcsv::tests
\ No newline at end of file
+    TEST(string_tests, read_long_escaped_quoted_string)
+    {
+        // Arrange
+        auto str = "\"a long string with \\\"several\\\" escaped \\\"quotes\\\" spread \\ through it\\\"\"\n"s;
+
+        // Act
+        auto result = read_csv<std::string>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result.size(), 1ul);
+        EXPECT_EQ(result[0], "a long string with \"several\" escaped \"quotes\" spread \\ through it\""s);
+    }
+
+    TEST(string_tests, unescape_in_place)
+    {
+        // Arrange
+        auto str = "\"some \\\"quoted\\\", string\""s;
+
+        // Act
+        unescape_in_place(str);
+
+        // Assert
+        EXPECT_EQ(str, "some \"quoted\", string"s);
+    }
+
+    TEST(string_tests, unescape_in_place_unquoted)
+    {
+        // Arrange
+        auto str = "some string"s;
+
+        // Act
+        auto result = unescape_in_place(str.data(), str.data() + str.size());
+
+        // Assert
+        EXPECT_EQ(result, "some string"sv);
+        EXPECT_EQ(result.data(), str.data());
+    }
+
+    TEST(string_tests, write_quotes_only_when_needed)
+    {
+        // Arrange
+        auto data = std::vector<std::string>{ "plain string longer than sixteen chars",
+                                              "delimiter after sixteen chars, here",
+                                              "a,b",
+                                              "line\nend",
+                                              "return\r",
+                                              "" };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "plain string longer than sixteen chars\r\n\"delimiter after sixteen chars, here\"\r\n"
+                        "\"a,b\"\r\n\"line\nend\"\r\n\"return\r\"\r\n\r\n"s;
+#else
+        auto expected = "plain string longer than sixteen chars\n\"delimiter after sixteen chars, here\"\n"
+                        "\"a,b\"\n\"line\nend\"\n\"return\r\"\n\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(string_tests, write_escaped_quotes)
+    {
+        // Arrange
+        auto data = std::vector<std::string>{ "\"", "a, \"long\" string with \"quotes\" past the first block\"" };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "\"\\\"\"\r\n\"a, \\\"long\\\" string with \\\"quotes\\\" past the first block\\\"\"\r\n"s;
+#else
+        auto expected = "\"\\\"\"\n\"a, \\\"long\\\" string with \\\"quotes\\\" past the first block\\\"\"\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(string_tests, round_trip_special_chars)
+    {
+        // Arrange
+        auto expected = std::vector<std::tuple<std::string, int>>{ { "multi\nline, \"quoted\"\r\nfield", 1 },
+                                                                   { "plain", 2 } };
+
+        // Act
+        auto csvString = write_csv(expected);
+        auto result = read_csv<std::tuple<std::string, int>>(csvString, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+}  // namespace fastcsv::tests
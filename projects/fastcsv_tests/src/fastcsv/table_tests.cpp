@@ -0,0 +1,117 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+using namespace std::chrono_literals;
+
+
+namespace fastcsv::tests
+{
+
+    using namespace std::chrono;
+
+    TEST(table_tests, read_with_types)
+    {
+        // Arrange
+        auto str = "sym,qty,px,active\n\"AAPL\",1,1.5,true\nMSFT,-2,2.5,false\n"s;
+        auto types = std::vector{ column_type::string, column_type::integer, column_type::floating_point,
+                                  column_type::boolean };
+
+        // Act
+        auto table = csv_table(str, types);
+
+        // Assert
+        EXPECT_EQ(table.rows(), 2ul);
+        EXPECT_EQ(table.columns(), 4ul);
+        EXPECT_EQ(table.column<std::string>("sym"), (std::vector{ "AAPL"s, "MSFT"s }));
+        EXPECT_EQ(table.column<int64_t>("qty"), (std::vector<int64_t>{ 1, -2 }));
+        EXPECT_EQ(table.column<double>("px"), (std::vector{ 1.5, 2.5 }));
+        EXPECT_EQ(table.column<bool>(3ul), (std::vector{ true, false }));
+    }
+
+    TEST(table_tests, read_inferred_schema)
+    {
+        // Arrange
+        auto str = "date,time,px\n2021-03-04,2021-03-04T05:06:07,1\n2021-03-05,2021-03-05T05:06:07.5,2.5\n"s;
+
+        // Act
+        auto table = csv_table(str);
+
+        // Assert
+        EXPECT_EQ(table.schema().columns[2].type, column_type::floating_point);
+        EXPECT_EQ(
+            table.column<year_month_day>("date"),
+            (std::vector<year_month_day>{ 2021y / March / 4d, 2021y / March / 5d }));
+        EXPECT_EQ(
+            table.column<sys_time<nanoseconds>>("time"),
+            (std::vector<sys_time<nanoseconds>>{ sys_days(2021y / March / 4d) + 5h + 6min + 7s,
+                                                 sys_days(2021y / March / 5d) + 5h + 6min + 7s + 500ms }));
+        EXPECT_EQ(table.column<double>("px"), (std::vector{ 1.0, 2.5 }));
+    }
+
+    TEST(table_tests, empty_fields_are_null)
+    {
+        // Arrange
+        auto str = "1,a\n,b\n3,\n"s;
+        auto schema = csv_schema{ { { "id", column_type::integer, false }, { "name", column_type::string, false } },
+                                  0ul };
+
+        // Act
+        auto table = csv_table(str, schema, no_header);
+
+        // Assert
+        EXPECT_EQ(table.column<int64_t>("id"), (std::vector<int64_t>{ 1, 0, 3 }));
+        EXPECT_EQ(table.column<std::string>("name"), (std::vector{ "a"s, "b"s, ""s }));
+        EXPECT_TRUE(table.is_null(0ul, 1ul));
+        EXPECT_FALSE(table.is_null(0ul, 0ul));
+        EXPECT_TRUE(table.is_null(1ul, 2ul));
+        EXPECT_TRUE(table.schema().columns[0].nullable);
+    }
+
+    TEST(table_tests, quoted_empty_fields_are_null)
+    {
+        // Arrange
+        auto str = "\"\",a\n2,\"\"\n"s;
+
+        // Act
+        auto table = csv_table(str, std::vector{ column_type::integer, column_type::string }, no_header);
+
+        // Assert
+        EXPECT_EQ(table.column<int64_t>(0ul), (std::vector<int64_t>{ 0, 2 }));
+        EXPECT_TRUE(table.is_null(0ul, 0ul));
+        EXPECT_TRUE(table.is_null(1ul, 1ul));
+        EXPECT_FALSE(table.is_null(1ul, 0ul));
+    }
+
+    TEST(table_tests, wrong_column_type_throws)
+    {
+        // Arrange
+        auto table = csv_table("px\n1.5\n"s, std::vector{ column_type::floating_point });
+
+        // Act / Assert
+        EXPECT_THROW((void)table.column<int64_t>("px"), fastcsv_exception);
+        EXPECT_THROW((void)table.column<double>("qty"), fastcsv_exception);
+        EXPECT_THROW((void)table.column<double>(1ul), fastcsv_exception);
+    }
+
+    TEST(table_tests, conversion_failure_throws_located)
+    {
+        // Arrange
+        auto str = "sym,qty\na,1\nb,x\n"s;
+
+        // Act / Assert
+        try
+        {
+            (void)csv_table(str, std::vector{ column_type::string, column_type::integer });
+            FAIL();
+        }
+        catch (const fastcsv_exception & exception)
+        {
+            EXPECT_EQ(exception.offset(), str.find('x'));
+            EXPECT_NE(std::string(exception.what()).find("line 2 column 1"), std::string::npos);
+        }
+    }
+
+}  // namespace fastcsv::tests
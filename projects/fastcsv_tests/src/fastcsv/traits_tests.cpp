@@ -31,4 +31,21 @@ namespace fastcsv::tests
         EXPECT_FALSE(fastcsv::has_to_csv<Unmapped>);
     }
 
+    TEST(csv_traits_tests, csv_never_needs_quoting)
+    {
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<int>);
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<uint8_t>);
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<double>);
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<bool>);
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<fastcsv::decimal<2>>);
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<std::optional<float>>);
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<std::chrono::year_month_day>);
+        EXPECT_TRUE(fastcsv::csv_never_needs_quoting_v<std::chrono::sys_seconds>);
+
+        EXPECT_FALSE(fastcsv::csv_never_needs_quoting_v<char>);
+        EXPECT_FALSE(fastcsv::csv_never_needs_quoting_v<std::string>);
+        EXPECT_FALSE(fastcsv::csv_never_needs_quoting_v<std::optional<std::string>>);
+        EXPECT_FALSE(fastcsv::csv_never_needs_quoting_v<Unmapped>);
+    }
+
 }  // namespace fastcsv::tests
\ No newline at end of file
@@ -28,6 +28,20 @@ namespace fastcsv::tests
         }
     }
 
+    TEST(tuple_tests, read_three_columns)
+    {
+        // Arrange
+        auto str = "1,one,1.5\n2,two,2.5\n"s;
+        auto expected = std::vector<std::tuple<int, std::string, double>>{ std::make_tuple(1, "one", 1.5),
+                                                                           std::make_tuple(2, "two", 2.5) };
+
+        // Act
+        auto result = read_csv<std::tuple<int, std::string, double>>(str, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
     TEST(tuple_tests, write)
     {
         // Arrange
@@ -122,4 +136,45 @@ namespace fastcsv::tests
         }
     }
 
-}  // namespace fastcsv::tests
\ No newline at end of file
+    TEST(tuple_tests, write_plain_row)
+    {
+        // Arrange
+        using row = std::tuple<int64_t, double, std::optional<int>, decimal<2>, bool>;
+        static_assert(detail::is_plain_row_v<char, std::char_traits<char>, int64_t, double, std::optional<int>>);
+        auto data = std::vector<row>{ { -1, 0.5, std::nullopt, decimal<2>::from_raw(150), true },
+                                      { 2, -3.0, 4, decimal<2>::from_raw(-5), false } };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "-1,0.5,,1.50,true\r\n2,-3,4,-0.05,false\r\n"s;
+#else
+        auto expected = "-1,0.5,,1.50,true\n2,-3,4,-0.05,false\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+    TEST(tuple_tests, write_nested_plain_row)
+    {
+        // Arrange
+        auto data = std::vector<std::tuple<std::string, std::tuple<int, int>, std::array<int, 2>>>{
+            { "a,b", { 1, 2 }, { 3, 4 } }
+        };
+
+#if defined(FASTCSV_PLATFORM_WIN)
+        auto expected = "\"a,b\",1,2,3,4\r\n"s;
+#else
+        auto expected = "\"a,b\",1,2,3,4\n"s;
+#endif
+
+        // Act
+        auto result = write_csv(data);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+    }
+
+}  // namespace fastcsv::tests
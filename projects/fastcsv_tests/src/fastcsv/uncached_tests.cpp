@@ -0,0 +1,47 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    TEST(uncached_tests, load_csv)
+    {
+        // Act
+        auto result = load_csv<std::tuple<int, std::string>>(data_path() / "no-headers.csv", uncached, no_header);
+
+        // Assert
+        EXPECT_EQ(result, (load_csv<std::tuple<int, std::string>>(data_path() / "no-headers.csv", no_header)));
+    }
+
+    TEST(uncached_tests, load_across_blocks)
+    {
+        // Arrange
+        auto path = std::filesystem::temp_directory_path() / "fastcsv_uncached_tests.csv";
+        auto expected = std::vector<int64_t>();
+        for (auto i = 0l; i < static_cast<int64_t>(detail::uncached_read_block / 8ul) + 1000l; ++i)
+        {
+            expected.push_back(1000000l + i);
+        }
+        save_csv(path, expected, no_header);
+
+        // Act
+        auto result = load_csv<int64_t>(path, uncached, no_header);
+
+        // Assert
+        EXPECT_EQ(result, expected);
+        std::filesystem::remove(path);
+    }
+
+    TEST(uncached_tests, missing_file_throws)
+    {
+        EXPECT_THROW(
+            (void)load_csv<int>(std::filesystem::temp_directory_path() / "fastcsv_uncached_missing.csv", uncached),
+            fastcsv_exception);
+    }
+
+}  // namespace fastcsv::tests
@@ -0,0 +1,108 @@
+#include <fastcsv/fastcsv.hpp>
+#include <fastcsv/locator.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace std::string_literals;
+
+
+namespace fastcsv::tests
+{
+
+    TEST(validate_tests, valid)
+    {
+        // Arrange
+        auto str = "name,count,price\n\"a,b\",1,1.5\nc,2,2.5\n"s;
+
+        // Act
+        auto result = validate_csv<std::string, int, double>(str);
+
+        // Assert
+        EXPECT_TRUE(result.valid());
+        EXPECT_EQ(result.rows, 2ul);
+        EXPECT_TRUE(result.violations.empty());
+    }
+
+    TEST(validate_tests, violations)
+    {
+        // Arrange
+        auto str = "a,1,1.5\nb,x,2.5\nc,3\nd,4,4.5,extra\ne,5,\"5.5\n"s;
+
+        // Act
+        auto result = validate_csv<std::string, int, double>(str, no_header);
+
+        // Assert
+        EXPECT_FALSE(result.valid());
+        EXPECT_EQ(result.rows, 5ul);
+        ASSERT_EQ(result.violation_count, 4ul);
+        ASSERT_EQ(result.violations.size(), 4ul);
+
+        EXPECT_EQ(result.violations[0].kind, violation_kind::conversion);
+        EXPECT_EQ(result.violations[0].row, 1ul);
+        EXPECT_EQ(result.violations[0].column, 1ul);
+        EXPECT_EQ(result.violations[0].offset, str.find('x'));
+
+        EXPECT_EQ(result.violations[1].kind, violation_kind::column_count);
+        EXPECT_EQ(result.violations[1].row, 2ul);
+        EXPECT_EQ(result.violations[1].column, 2ul);
+        EXPECT_EQ(result.violations[1].offset, str.find("c,3"));
+
+        EXPECT_EQ(result.violations[2].kind, violation_kind::column_count);
+        EXPECT_EQ(result.violations[2].row, 3ul);
+        EXPECT_EQ(result.violations[2].column, 4ul);
+
+        EXPECT_EQ(result.violations[3].kind, violation_kind::unbalanced_quote);
+        EXPECT_EQ(result.violations[3].row, 4ul);
+        EXPECT_EQ(result.violations[3].column, 2ul);
+        EXPECT_FALSE(result.violations[3].message().empty());
+    }
+
+    TEST(validate_tests, max_violations)
+    {
+        // Arrange
+        auto str = "x\ny\nz\n1\n"s;
+
+        // Act
+        auto result = validate_csv<int>(str, 2ul, no_header);
+
+        // Assert
+        EXPECT_EQ(result.violation_count, 3ul);
+        ASSERT_EQ(result.violations.size(), 2ul);
+        EXPECT_EQ(result.violations[0].row, 0ul);
+        EXPECT_EQ(result.violations[1].row, 1ul);
+    }
+
+    TEST(validate_tests, chunks_match_single_pass)
+    {
+        // Arrange
+        auto str = "id,name\n"s;
+        for (auto i = 0; i < 500; ++i)
+        {
+            str += (i % 37 == 0) ? "bad" : std::to_string(i);
+            str += (i % 11 == 0) ? ",\"multi\nline\n\"\n" : ",name\n";
+        }
+
+        constexpr auto validators = std::array<detail::field_validator, 2ul>{ &detail::validate_field<int>,
+                                                                              &detail::validate_field<std::string> };
+        const auto begin = str.find('\n') + 1ul;
+
+        // Act
+        auto expected = detail::validate_chunks(str, begin, 1ul, validators, 100ul, 1ul);
+
+        // Assert
+        for (auto chunkCount : { 2ul, 7ul, 64ul })
+        {
+            auto result = detail::validate_chunks(str, begin, 1ul, validators, 100ul, chunkCount);
+            EXPECT_EQ(result.rows, expected.rows);
+            EXPECT_EQ(result.rows, 500ul);
+            EXPECT_EQ(result.violation_count, expected.violation_count);
+            ASSERT_EQ(result.violations.size(), expected.violations.size());
+            for (auto i = 0ul; i < result.violations.size(); ++i)
+            {
+                EXPECT_EQ(result.violations[i].row, expected.violations[i].row);
+                EXPECT_EQ(result.violations[i].offset, expected.violations[i].offset);
+            }
+        }
+    }
+
+}  // namespace fastcsv::tests
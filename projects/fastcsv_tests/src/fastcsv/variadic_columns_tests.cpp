@@ -169,4 +169,27 @@ namespace fastcsv::tests
         }
     }
 
+    TEST(variadic_columns_tests, write_matches_rows_across_blocks)
+    {
+        // Arrange
+        const auto size = detail::column_block_rows * 2ul + 3ul;
+        auto data1 = std::vector<int64_t>();
+        auto data2 = std::vector<std::string>();
+        auto data3 = std::vector<double>();
+        auto rows = std::vector<std::tuple<int64_t, std::string, double>>();
+        for (auto i = 0ul; i < size; ++i)
+        {
+            data1.push_back(static_cast<int64_t>(i * i) - 1000);
+            data2.push_back(i % 3ul == 0ul ? "a, \"b\""s : std::string(i % 5ul, 'x'));
+            data3.push_back(static_cast<double>(i) / 8.0);
+            rows.emplace_back(data1.back(), data2.back(), data3.back());
+        }
+
+        // Act
+        auto result = write_csv_v(data1, data2, data3);
+
+        // Assert
+        EXPECT_EQ(result, write_csv(rows));
+    }
+
 }  // namespace fastcsv::tests
\ No newline at end of file